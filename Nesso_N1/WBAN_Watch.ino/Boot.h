@@ -0,0 +1,53 @@
+#ifndef BOOT_H
+#define BOOT_H
+
+#include <Arduino.h>
+
+// Fall protection must be armed (IMU + ESP-NOW + classifier sampling)
+// within this many ms of power-on. Everything else boots in the background.
+#define BOOT_ARM_TARGET_MS 1000
+
+class BootProfiler {
+  public:
+    bool armed = false;
+    bool firstInferenceDone = false;
+    unsigned long armedAt = 0;
+    unsigned long firstInferenceAt = 0;
+
+    // Logs a boot stage with its absolute time since power-on (millis()
+    // starts counting at reset) and the time spent since the previous mark.
+    void mark(const char* stage) {
+      unsigned long now = millis();
+      Serial.printf("[BOOT] %-18s t=%5lu ms  (+%lu ms)\n", stage, now, now - lastMark);
+      lastMark = now;
+    }
+
+    // Called right before the first sampling window starts.
+    void markArmed() {
+      if (armed) return;
+      armed = true;
+      armedAt = millis();
+      mark("ARMED");
+      if (armedAt <= BOOT_ARM_TARGET_MS) {
+        Serial.printf("✅ Fall protection armed in %lu ms (target %d ms)\n", armedAt, BOOT_ARM_TARGET_MS);
+      } else {
+        Serial.printf("⚠️ Fall protection armed in %lu ms - OVER target of %d ms!\n", armedAt, BOOT_ARM_TARGET_MS);
+      }
+    }
+
+    // Called once the first classifier result is available. The gap from
+    // armedAt is the model's window length plus inference time.
+    void markFirstInference() {
+      if (firstInferenceDone) return;
+      firstInferenceDone = true;
+      firstInferenceAt = millis();
+      mark("FIRST INFERENCE");
+    }
+
+  private:
+    unsigned long lastMark = 0;
+};
+
+extern BootProfiler Boot;
+
+#endif
@@ -2,12 +2,14 @@
 #define CONNECTIVITY_H
 
 #include "Config.h"
+#include "Boot.h"
 #include <WiFi.h>
 #include <HTTPClient.h>
 #include <WiFiClientSecure.h> 
 #include <HardwareSerial.h>
 #include <SoftwareSerial.h> 
 #include <time.h> 
+#include <esp_sntp.h>
 #include <base64.h>           
 
 // --- PIN DEFINITIONS (ESP32-C6) ---
@@ -19,6 +21,15 @@
 #define PHONE_NUMBER "+916381146811" 
 #define GSM_APN "airtelgprs.com" 
 
+// --- BACKGROUND BOOT STAGES (MODEM) ---
+enum ModemBootStage {
+  MODEM_POWER_UP,   // Waiting for the SIM800L to come out of reset
+  MODEM_SET_SMS,    // AT+CMGF=1 sent
+  MODEM_SET_CLOCK,  // AT+CLTS=1 sent
+  MODEM_SET_APN,    // AT+CGDCONT sent
+  MODEM_READY
+};
+
 class ConnectivityManager {
   private:
     HardwareSerial gsmSerial;
@@ -28,6 +39,12 @@ class ConnectivityManager {
     unsigned long lastWifiCheck = 0;
     unsigned long lastUploadTime = 0; 
 
+    // --- BACKGROUND BOOT STATE ---
+    ModemBootStage modemStage = MODEM_POWER_UP;
+    unsigned long modemStageTime = 0;
+    bool ntpRequested = false;
+    bool wifiReported = false;
+
     // --- OFFLINE RETRY STORAGE ---
     bool pendingAlert = false;
     unsigned long lastRetryTime = 0;
@@ -38,6 +55,12 @@ class ConnectivityManager {
   public:
     ConnectivityManager() : gsmSerial(1), gpsSerial(GPS_RX_PIN, DUMMY_TX_PIN) {}
 
+    // --- READINESS FLAGS (set by the background boot) ---
+    bool modemReady = false;
+    bool wifiReady = false;
+
+    // Non-blocking: only kicks off WiFi and the UARTs. The modem AT setup
+    // and NTP sync are advanced by serviceBoot() so they never delay arming.
     void begin() {
       if(SERIAL_DEBUG) Serial.println("🌐 Initializing WiFi...");
       WiFi.mode(WIFI_STA); 
@@ -45,23 +68,78 @@ class ConnectivityManager {
 
       gsmSerial.begin(9600, SERIAL_8N1, GSM_RX_PIN, GSM_TX_PIN);
       gpsSerial.begin(9600);
-      
-      delay(3000); 
-      gsmSerial.println("AT+CMGF=1"); 
-      delay(500);
-      gsmSerial.println("AT+CLTS=1"); 
-      delay(500);
 
-      if(SERIAL_DEBUG) Serial.println("📶 Configuring 4G LTE APN...");
-      gsmSerial.print("AT+CGDCONT=1,\"IP\",\"");
-      gsmSerial.print(GSM_APN);
-      gsmSerial.println("\"");
-      delay(1000);
+      modemStage = MODEM_POWER_UP;
+      modemStageTime = millis();
     }
-    
+
+    bool bootComplete() {
+      return modemReady && Core.timeSynced;
+    }
+
+    // An alert is stored for the Tier-3 retry
+    bool alertPending() {
+      return pendingAlert;
+    }
+
+    // One step of the background boot per call, driven by timestamps
+    // instead of delay() (same waits as the old blocking sequence).
+    // Called from the 20 ms sampling loop, so nothing in here may wait.
+    void serviceBoot() {
+      if (bootComplete()) return;
+      unsigned long now = millis();
+      unsigned long elapsed = now - modemStageTime;
+
+      if (modemStage == MODEM_POWER_UP && elapsed >= 3000) {
+        gsmSerial.println("AT+CMGF=1"); 
+        modemStage = MODEM_SET_SMS;
+        modemStageTime = now;
+      } else if (modemStage == MODEM_SET_SMS && elapsed >= 500) {
+        gsmSerial.println("AT+CLTS=1"); 
+        modemStage = MODEM_SET_CLOCK;
+        modemStageTime = now;
+      } else if (modemStage == MODEM_SET_CLOCK && elapsed >= 500) {
+        if(SERIAL_DEBUG) Serial.println("📶 Configuring 4G LTE APN...");
+        gsmSerial.print("AT+CGDCONT=1,\"IP\",\"");
+        gsmSerial.print(GSM_APN);
+        gsmSerial.println("\"");
+        modemStage = MODEM_SET_APN;
+        modemStageTime = now;
+      } else if (modemStage == MODEM_SET_APN && elapsed >= 1000) {
+        modemStage = MODEM_READY;
+        modemReady = true;
+        Boot.mark("MODEM READY");
+      }
+
+      bool wifiUp = (WiFi.status() == WL_CONNECTED);
+      if (wifiUp && !wifiReported) {
+        wifiReported = true;
+        Boot.mark("WIFI CONNECTED");
+      }
+
+      // NTP: request once WiFi is up, then poll the SNTP status.
+      // getLocalTime() is not an option here: even with a 0 ms timeout it
+      // spends delay(10) on every miss, half of each IMU sample period.
+      if (wifiUp && !ntpRequested) {
+        if(SERIAL_DEBUG) Serial.println("🔄 Requesting Network Time from WiFi (NTP)...");
+        configTime(19800, 0, "pool.ntp.org", "time.nist.gov"); 
+        ntpRequested = true;
+      }
+      if (ntpRequested && !Core.timeSynced) {
+        struct tm timeinfo;
+        if (sntp_get_sync_status() == SNTP_SYNC_STATUS_COMPLETED && getLocalTime(&timeinfo, 0)) {
+          Core.setTime(timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
+          Boot.mark("TIME SYNCED");
+        }
+      }
+    }
+
     void update() {
       unsigned long now = millis();
 
+      wifiReady = (WiFi.status() == WL_CONNECTED);
+      serviceBoot();
+
       if (now - lastWifiCheck > NETWORK_CHECK_RATE) {
         lastWifiCheck = now;
         if (WiFi.status() != WL_CONNECTED) {
@@ -83,6 +161,7 @@ class ConnectivityManager {
 
       while (gpsSerial.available()) {
         String line = gpsSerial.readStringUntil('\n');
+        line.trim();  // NMEA ends in \r\n; a stray \r breaks the alert JSON
         if (line.startsWith("$GNRMC") || line.startsWith("$GPRMC")) {
           latestGpsData = line; 
         }
@@ -126,11 +205,12 @@ class ConnectivityManager {
       
       String finalLocation = latestGpsData;
       if (latestGpsData.indexOf(",V,") > 0 || latestGpsData.indexOf("Scanning") >= 0) {
-        finalLocation = getFallbackLBS();
+        // A modem that is still booting would stall the alert for up to 10 s
+        finalLocation = modemReady ? getFallbackLBS() : "Location Unavailable";
       }
 
       // TIER 1: PRIMARY (Hardware GSM SMS)
-      if (isGsmAvailable()) {
+      if (modemReady && isGsmAvailable()) {
         Serial.println("📱 TIER 1: Attempting Hardware GSM SMS...");
         bool gsmSuccess = sendGsmSms(source, finalLocation);
         if (gsmSuccess) {
@@ -140,7 +220,7 @@ class ConnectivityManager {
            Serial.println("❌ GSM Failed to send. Falling back...");
         }
       } else {
-         Serial.println("⚠️ TIER 1: GSM Module Offline/No Signal.");
+         Serial.println(modemReady ? "⚠️ TIER 1: GSM Module Offline/No Signal." : "⚠️ TIER 1: GSM Module Still Booting.");
       }
 
       // TIER 2: BACKUP (WiFi API SMS + Backend Dashboard)
@@ -283,17 +363,6 @@ class ConnectivityManager {
       }
     }
     
-    void syncTimeWithWiFi() {
-      if(SERIAL_DEBUG) Serial.println("🔄 Requesting Network Time from WiFi (NTP)...");
-      configTime(19800, 0, "pool.ntp.org", "time.nist.gov"); 
-      struct tm timeinfo;
-      if(!getLocalTime(&timeinfo, 5000)){
-        if(SERIAL_DEBUG) Serial.println("❌ Failed to obtain time from WiFi");
-        return;
-      }
-      Core.setTime(timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
-    }
-
     void syncTimeWithGSM() {
       gsmSerial.println("AT+CCLK?"); 
       long startWait = millis();
@@ -7,6 +7,7 @@
 class SensorManager {
   public:
     int stepCount = 0;
+    unsigned long lastStepTime = 0;
     
     void begin() {
       if (!IMU.begin()) {
@@ -27,7 +28,6 @@ class SensorManager {
         
         // Simple Pedometer Logic
         // Uses a non-blocking timer to prevent double-counting steps
-        static unsigned long lastStepTime = 0;
         if (mag > STEP_THRESHOLD && (millis() - lastStepTime > 300)) {
           stepCount++;
           lastStepTime = millis();
@@ -14,6 +14,9 @@ class UIManager {
   public:
     M5GFX display; 
     Page currentPage = PAGE_CLOCK;
+    bool ready = false; // Set once the display is up (initialized after arming)
+    unsigned long bootSplashUntil = 0;
+    unsigned long lastDraw = 0;
     
     // Touch tracking variables
     bool wasTouched = false;
@@ -29,16 +32,23 @@ class UIManager {
       digitalWrite(LCD_BACKLIGHT, HIGH);
       
       showBoot();
+      ready = true;
     }
 
     void update() {
-      if (!Core.isScreenOn) return;
+      if (!ready || !Core.isScreenOn) return;
+
+      // Hold the boot splash without blocking, then clear it
+      if (bootSplashUntil != 0) {
+        if (millis() < bootSplashUntil) return;
+        display.fillScreen(TFT_BLACK);
+        bootSplashUntil = 0;
+      }
 
       // 1. Check for touch input instantly
       handleTouch();
 
       // 2. Redraw the screen every 200ms
-      static unsigned long lastDraw = 0;
       if (millis() - lastDraw > 200) { 
         if (currentPage == PAGE_CLOCK) drawClock();
         else if (currentPage == PAGE_SAFETY_CHECK) drawSafetyCheck();
@@ -51,6 +61,7 @@ class UIManager {
 
     // --- TOUCH ENGINE ---
     void handleTouch() {
+      if (!ready) return;
       uint16_t x, y;
       bool isTouched = display.getTouch(&x, &y);
 
@@ -112,8 +123,7 @@ class UIManager {
       display.setTextSize(2);
       display.setTextColor(TFT_BLUE);
       display.drawString("NESSO N1", 120, 60);
-      delay(1000);
-      display.fillScreen(TFT_BLACK);
+      bootSplashUntil = millis() + 1000;
     }
 
     // --- SLIDE 1: THE CLOCK ---
@@ -9,6 +9,7 @@
  */
 
 #include "Config.h"
+#include "Boot.h"
 #include "Core.h"
 #include "Sensors.h"
 #include "UI.h"
@@ -34,6 +35,7 @@
 #include <Arduino_Nesso_N1.h> 
 
 // --- GLOBAL OBJECTS ---
+BootProfiler Boot;
 CoreManager Core;
 SensorManager Sensors;
 UIManager UI;
@@ -68,54 +70,40 @@ void OnDataRecv(const esp_now_recv_info_t * info, const uint8_t *incomingDataPtr
 }
 
 // -------------------------------------------------------------------------
-// SETUP
+// SETUP (FAST BOOT)
+// Only what fall protection needs runs here: IMU, button, ESP-NOW, battery.
+// UI, modem, WiFi and NTP come up in the background from loop().
 // -------------------------------------------------------------------------
 void setup() {
   Serial.begin(115200);
-  delay(3000); 
   Serial.println("\n\n========================================");
   Serial.println("   NESSO N1 - DEBUG FIRMWARE STARTING    ");
   Serial.println("========================================");
+  Boot.mark("SERIAL");
 
-  // 1. UI
-  Serial.print("[BOOT] 1. Initializing UI... ");
-  UI.begin();
-  Serial.println("OK");
-  
-  // 2. Connectivity & Core
-  Serial.print("[BOOT] 2. Initializing WiFi/GSM & Core... ");
-  Core.begin();
-  Connectivity.begin(); 
-  
-  // ---> SYNC TIME USING WIFI <---
-  Connectivity.syncTimeWithWiFi(); 
-  Serial.println("OK");
-
-  // 3. Sensors
-  Serial.print("[BOOT] 3. Initializing IMU... ");
+  // 1. Sensors
   Sensors.begin();
-  if (!IMU.begin()) {
-    Serial.println("FAIL (Check Hardware!)");
-  } else {
-    Serial.println("OK");
-  }
+  Boot.mark("IMU");
 
-  // 4. Button
-  Serial.print("[BOOT] 4. Initializing Button (KEY1)... ");
+  // 2. Button
   pinMode(KEY1, INPUT_PULLUP);
-  Serial.println("OK");
+  Boot.mark("BUTTON");
 
-  // 5. ESP-NOW
-  Serial.print("[BOOT] 5. Initializing ESP-NOW... ");
+  // 3. WiFi radio + ESP-NOW (WiFi.begin() is non-blocking)
+  Connectivity.begin();
   if (esp_now_init() != ESP_OK) {
-    Serial.println("FAIL!");
+    Serial.println("❌ ESP-NOW Init FAIL!");
   } else {
     esp_now_register_recv_cb(OnDataRecv);
-    Serial.println("OK (Listening for Dress)");
   }
+  Boot.mark("ESP-NOW");
+
+  // 4. Core (battery + backlight)
+  Core.begin();
+  Boot.mark("CORE");
 
   Serial.println("----------------------------------------");
-  Serial.println("✅ SYSTEM READY - Waiting for Data...");
+  Serial.println("✅ CRITICAL PATH READY - Background boot continues in loop()");
 }
 
 // -------------------------------------------------------------------------
@@ -136,6 +124,12 @@ void loop() {
   }
 
   runAILogic();
+
+  // ---> BACKGROUND BOOT: UI comes up after the first window is armed <---
+  if (!UI.ready) {
+    UI.begin();
+    Boot.mark("UI READY");
+  }
 }
 
 // -------------------------------------------------------------------------
@@ -168,6 +162,8 @@ void checkManualSOS() {
 // AI LOGIC (WITH HARDWARE BENCHMARKING & TOUCH POLLING)
 // -------------------------------------------------------------------------
 void runAILogic() {
+  Boot.markArmed();
+
   for (int i = 0; i < EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE; i += EI_CLASSIFIER_SENSOR_AXES_COUNT) {
       float x, y, z;
       unsigned long startMicros = micros(); 
@@ -175,6 +171,7 @@ void runAILogic() {
       // --- CHECK TASKS WHILE GATHERING DATA ---
       checkManualSOS();
       UI.handleTouch(); // <--- INSTANT TOUCH RESPONSE FIX 
+      Connectivity.serviceBoot(); // Background boot keeps its pace while sampling
 
       if (IMU.accelerationAvailable()) {
           IMU.readAcceleration(x, y, z);
@@ -201,6 +198,8 @@ void runAILogic() {
   unsigned long endInference = millis();
 
   if (res == EI_IMPULSE_OK) {
+      Boot.markFirstInference();
+
       // PRINT CALIBRATION DATA TO SERIAL MONITOR
       Serial.println("\n--- 📊 HARDWARE CALIBRATION REPORT ---");
       Serial.print("⏱️ Total Inference Time: "); Serial.print(endInference - startInference); Serial.println(" ms");
@@ -0,0 +1,10 @@
+// Compiles the unmodified watch sketch against the host HAL in hal/.
+// The Arduino IDE normally injects the Arduino.h include itself.
+#include <Arduino.h>
+#include "WBAN_Watch.ino.ino"
+
+// features[] (the sample window) has internal linkage, so only this
+// translation unit can reach it. The fleet simulator swaps it per watch
+// through these, since a watch can park on the backend mid-window.
+void simSaveFeatures(float* out) { memcpy(out, features, sizeof(features)); }
+void simLoadFeatures(const float* in) { memcpy(features, in, sizeof(features)); }
@@ -0,0 +1,605 @@
+/*
+ * WBAN Fleet Simulator
+ * --------------------
+ * Runs N copies of the watch firmware (built for the host, see hal/) on a
+ * shared virtual clock. Every watch is a discrete event source: an event
+ * is one setup() or loop() pass of that watch, and the watch is put back
+ * in the queue at whatever virtual time the pass ended. Watches only meet
+ * at the backend, so stepping them out of lockstep is safe and the fleet
+ * runs much faster than real time.
+ *
+ * Each watch's firmware runs on its own fiber (ucontext). A backend POST
+ * parks the fiber and hands the request to a worker pool that keeps up to
+ * --http-concurrency requests in flight; the scheduler meanwhile steps the
+ * other watches and resumes the parked one when its response arrives. The
+ * backend therefore sees fleet-scale concurrent load, and a slow backend
+ * only slows the watches waiting on it, never the virtual clock of the rest.
+ *
+ * Fan-out is measured the way the React dashboard sees it: --dashboards
+ * socket.io subscribers stay connected to the backend, and every POST the
+ * fleet makes is tagged with a "simSeq" that comes back in the broadcast.
+ *
+ * --stub-backend runs a minimal backend (HTTP 201 + socket.io broadcast) on
+ * a loopback port inside the simulator, so ctest covers that whole path.
+ *
+ * Usage: wban_fleet_sim [--watches N] [--duration S] [--backend host:port]
+ *                       [--stub-backend] [--http-concurrency N] [--dashboards N]
+ *                       [--scenario FILE] [--fall-rate R] [--sos-rate R]
+ *                       [--boot-spread S] [--no-gsm] [--seed N]
+ *                       [--poll-us N] [--trace-watch N]
+ *                       [--min-detection F] [--max-armed-ms N]
+ *                       [--min-alert-posts N] [--min-fanout F]
+ *                       [--max-false-alarms N]
+ */
+
+#include <Arduino.h>
+#include "Boot.h"
+#include "Core.h"
+#include "Sensors.h"
+#include "UI.h"
+#include "Connectivity.h"
+#include "DNN_1_Dataset_inferencing.h"
+#include "SimDevice.h"
+#include "BackendClient.h"
+#include "DashboardSubscriber.h"
+#include "StubBackend.h"
+#include "Metrics.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <random>
+#include <sstream>
+#include <string>
+#include <sys/mman.h>
+#include <thread>
+#include <ucontext.h>
+#include <vector>
+
+// --- FIRMWARE ENTRY POINTS AND GLOBALS (WBAN_Watch.ino.ino) ---
+void setup();
+void loop();
+extern float currentPressure;
+extern bool lastBtnState;
+extern unsigned long lastPressTime;
+// --- SAMPLE WINDOW (Firmware.cpp) ---
+void simSaveFeatures(float* out);
+void simLoadFeatures(const float* in);
+
+// The firmware keeps its state in globals. Each watch owns a copy that is
+// swapped in before its event and back out after it.
+struct FirmwareState {
+  BootProfiler boot;
+  CoreManager core;
+  SensorManager sensors;
+  UIManager ui;
+  ConnectivityManager connectivity;
+  float pressure = 0.0f;
+  bool btnState = HIGH;
+  unsigned long pressTime = 0;
+  float features[EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE] = {};
+
+  void load() const {
+    Boot = boot;
+    Core = core;
+    Sensors = sensors;
+    UI = ui;
+    Connectivity = connectivity;
+    currentPressure = pressure;
+    lastBtnState = btnState;
+    lastPressTime = pressTime;
+    simLoadFeatures(features);
+  }
+
+  void save() {
+    boot = Boot;
+    core = Core;
+    sensors = Sensors;
+    ui = UI;
+    connectivity = Connectivity;
+    pressure = currentPressure;
+    btnState = lastBtnState;
+    pressTime = lastPressTime;
+    simSaveFeatures(features);
+  }
+};
+
+struct Watch {
+  sim::Device device;
+  FirmwareState firmware;
+  ucontext_t fiber;
+  void* stack = nullptr;
+  bool parked = false;   // waiting on the backend pool
+};
+
+struct Options {
+  int watches = 100;
+  double durationSec = 3600;
+  std::string backend;
+  bool stubBackend = false;
+  int httpConcurrency = 32;
+  int dashboards = 1;      // socket.io subscribers, only with --backend
+  std::string scenario;
+  double fallRate = 0.0;   // per watch-hour
+  double sosRate = 0.0;    // per watch-hour
+  double bootSpreadSec = 10;
+  bool gsm = true;
+  uint64_t seed = 1;
+  uint64_t pollUs = 1000;
+  int traceWatch = -1;
+  double minDetection = -1.0;
+  long maxArmedMs = -1;
+  long minAlertPosts = -1;
+  double minFanout = -1.0;  // fraction of expected broadcasts received
+  long maxFalseAlarms = -1;
+};
+
+static const uint64_t US_PER_SEC = 1000000;
+
+static uint64_t secToUs(double sec) { return (uint64_t)(sec * US_PER_SEC); }
+
+// -------------------------------------------------------------------------
+// FIBERS
+// -------------------------------------------------------------------------
+// Firmware locals are small (the sample window is a static, swapped with
+// FirmwareState), but String and printf buffers nest; pages are only
+// committed when touched
+static const size_t FIBER_STACK_BYTES = 256 * 1024;
+
+static ucontext_t schedulerContext;
+static Watch* running = nullptr;
+
+// Body of every watch: the Arduino main(), yielding after each loop() pass
+static void firmwareMain() {
+  setup();
+  for (;;) {
+    swapcontext(&running->fiber, &schedulerContext);
+    loop();
+  }
+}
+
+static bool createFiber(Watch& w) {
+  w.stack = mmap(nullptr, FIBER_STACK_BYTES, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_STACK, -1, 0);
+  if (w.stack == MAP_FAILED) return false;
+  getcontext(&w.fiber);
+  w.fiber.uc_stack.ss_sp = w.stack;
+  w.fiber.uc_stack.ss_size = FIBER_STACK_BYTES;
+  w.fiber.uc_link = nullptr;
+  makecontext(&w.fiber, firmwareMain, 0);
+
+  w.device.park = [&w]() {
+    w.parked = true;
+    swapcontext(&w.fiber, &schedulerContext);
+  };
+  return true;
+}
+
+// Runs the watch until it finishes a loop() pass or parks on the backend
+static void resume(Watch& w) {
+  running = &w;
+  sim::g_current = &w.device;
+  w.firmware.load();
+  swapcontext(&schedulerContext, &w.fiber);
+  w.firmware.save();
+  sim::g_current = nullptr;
+  running = nullptr;
+}
+
+// splitmix64: stable per-watch hash for "P%" / "A-B%" targets and per-watch seeds
+static uint64_t mix(uint64_t x) {
+  x += 0x9E3779B97F4A7C15ULL;
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+  return x ^ (x >> 31);
+}
+
+// -------------------------------------------------------------------------
+// SCENARIO
+// -------------------------------------------------------------------------
+static bool targets(const std::string& target, int watchId) {
+  if (target == "*") return true;
+  if (!target.empty() && target.back() == '%') {
+    // "P%" is the band [0, P); "A-B%" is [A, B) and never overlaps "A%"
+    size_t dash = target.find('-');
+    double from = dash == std::string::npos ? 0.0 : atof(target.c_str());
+    double to = atof(target.c_str() + (dash == std::string::npos ? 0 : dash + 1));
+    uint64_t slot = mix((uint64_t)watchId) % 10000;
+    return slot >= (uint64_t)(from * 100.0) && slot < (uint64_t)(to * 100.0);
+  }
+  return atoi(target.c_str()) == watchId;
+}
+
+static bool applyEvent(std::vector<Watch>& fleet, sim::Metrics& metrics, double atSec,
+                       const std::string& event, const std::string& target, double durationSec) {
+  sim::Window window = {secToUs(atSec), secToUs(atSec + durationSec)};
+  for (Watch& w : fleet) {
+    if (!targets(target, w.device.id)) continue;
+    sim::Device& d = w.device;
+    if (event == "fall") { d.falls.push_back(window.startUs); metrics.injectedFalls++; }
+    else if (event == "sos") { d.sosPresses.push_back(window.startUs); metrics.injectedSos++; }
+    else if (event == "squeeze") { d.squeezes.push_back(window); metrics.injectedSqueezes++; }
+    else if (event == "wifi-outage") d.wifiOutages.push_back(window);
+    else if (event == "backend-outage") d.backendOutages.push_back(window);
+    else if (event == "gsm-outage") d.gsmOutages.push_back(window);
+    else return false;
+  }
+  return true;
+}
+
+static bool loadScenario(const std::string& path, std::vector<Watch>& fleet, sim::Metrics& metrics) {
+  std::ifstream in(path);
+  if (!in) {
+    fprintf(stderr, "❌ Cannot open scenario %s\n", path.c_str());
+    return false;
+  }
+  std::string line;
+  int lineNo = 0;
+  while (std::getline(in, line)) {
+    lineNo++;
+    size_t hash = line.find('#');
+    if (hash != std::string::npos) line.erase(hash);
+    std::istringstream fields(line);
+    double atSec = 0.0, durationSec = 0.0;
+    std::string event, target;
+    if (!(fields >> atSec)) continue;  // blank or comment
+    if (!(fields >> event >> target)) {
+      fprintf(stderr, "❌ %s:%d: expected <time_s> <event> <target> [duration_s]\n", path.c_str(), lineNo);
+      return false;
+    }
+    fields >> durationSec;
+    if (!applyEvent(fleet, metrics, atSec, event, target, durationSec)) {
+      fprintf(stderr, "❌ %s:%d: unknown event '%s'\n", path.c_str(), lineNo, event.c_str());
+      return false;
+    }
+  }
+  return true;
+}
+
+// Poisson arrivals per watch, kept a minute clear of both ends of the run
+// so every injected event has time to be armed for and alerted on
+static void addRandomEvents(std::vector<Watch>& fleet, sim::Metrics& metrics, const Options& opt) {
+  double first = 60.0, last = opt.durationSec - 60.0;
+  for (Watch& w : fleet) {
+    std::mt19937_64 rng(mix(opt.seed ^ ((uint64_t)w.device.id << 20)));
+    auto arrivals = [&](double ratePerHour, std::vector<uint64_t>& out, uint64_t& counter) {
+      if (ratePerHour <= 0.0) return;
+      std::exponential_distribution<double> gap(ratePerHour / 3600.0);
+      for (double t = first + gap(rng); t < last; t += gap(rng)) {
+        out.push_back(secToUs(t));
+        counter++;
+      }
+    };
+    arrivals(opt.fallRate, w.device.falls, metrics.injectedFalls);
+    arrivals(opt.sosRate, w.device.sosPresses, metrics.injectedSos);
+  }
+}
+
+// -------------------------------------------------------------------------
+// COMMAND LINE
+// -------------------------------------------------------------------------
+static bool parseArgs(int argc, char** argv, Options& opt) {
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    auto value = [&]() -> const char* {
+      if (i + 1 >= argc) {
+        fprintf(stderr, "❌ %s needs a value\n", arg.c_str());
+        exit(2);
+      }
+      return argv[++i];
+    };
+    if (arg == "--watches") opt.watches = atoi(value());
+    else if (arg == "--duration") opt.durationSec = atof(value());
+    else if (arg == "--backend") opt.backend = value();
+    else if (arg == "--stub-backend") opt.stubBackend = true;
+    else if (arg == "--http-concurrency") opt.httpConcurrency = atoi(value());
+    else if (arg == "--dashboards") opt.dashboards = atoi(value());
+    else if (arg == "--scenario") opt.scenario = value();
+    else if (arg == "--fall-rate") opt.fallRate = atof(value());
+    else if (arg == "--sos-rate") opt.sosRate = atof(value());
+    else if (arg == "--boot-spread") opt.bootSpreadSec = atof(value());
+    else if (arg == "--no-gsm") opt.gsm = false;
+    else if (arg == "--seed") opt.seed = strtoull(value(), nullptr, 10);
+    else if (arg == "--poll-us") opt.pollUs = strtoull(value(), nullptr, 10);
+    else if (arg == "--trace-watch") opt.traceWatch = atoi(value());
+    else if (arg == "--min-detection") opt.minDetection = atof(value());
+    else if (arg == "--max-armed-ms") opt.maxArmedMs = atol(value());
+    else if (arg == "--min-alert-posts") opt.minAlertPosts = atol(value());
+    else if (arg == "--min-fanout") opt.minFanout = atof(value());
+    else if (arg == "--max-false-alarms") opt.maxFalseAlarms = atol(value());
+    else {
+      fprintf(stderr, "❌ Unknown option %s (see the header of FleetSim.cpp)\n", arg.c_str());
+      return false;
+    }
+  }
+  if (opt.watches <= 0 || opt.durationSec <= 0 || opt.pollUs == 0 || opt.httpConcurrency <= 0) {
+    fprintf(stderr, "❌ --watches, --duration, --poll-us and --http-concurrency must be positive\n");
+    return false;
+  }
+  if (opt.stubBackend && !opt.backend.empty()) {
+    fprintf(stderr, "❌ --stub-backend and --backend are exclusive\n");
+    return false;
+  }
+  if (opt.dashboards < 0) {
+    fprintf(stderr, "❌ --dashboards cannot be negative\n");
+    return false;
+  }
+  return true;
+}
+
+// -------------------------------------------------------------------------
+// DASHBOARD FAN-OUT
+// -------------------------------------------------------------------------
+typedef std::vector<std::unique_ptr<sim::DashboardSubscriber>> Dashboards;
+
+static Dashboards connectDashboards(const Options& opt) {
+  Dashboards dashboards;
+  if (opt.backend.empty()) return dashboards;
+  for (int i = 0; i < opt.dashboards; i++) {
+    dashboards.emplace_back(new sim::DashboardSubscriber());
+    if (!dashboards.back()->start(opt.backend)) {
+      fprintf(stderr, "⚠️ No socket.io endpoint at %s, fan-out will not be measured (--dashboards 0 to skip)\n",
+              opt.backend.c_str());
+      dashboards.clear();
+      break;
+    }
+  }
+  return dashboards;
+}
+
+// Gives broadcasts still on the wire a moment to land, then matches every
+// delivery to the POST that caused it
+static void collectFanout(Dashboards& dashboards, sim::Metrics& m) {
+  if (dashboards.empty()) return;
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+  for (auto& d : dashboards) {
+    while (d->received() < m.posted.size() && std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    d->stop();
+  }
+
+  for (auto& d : dashboards) {
+    for (const sim::Delivery& del : d->deliveries()) {
+      auto it = m.posted.find(del.seq);
+      if (it == m.posted.end()) continue;
+      double ms = std::chrono::duration<double, std::milli>(del.at - it->second.sentAt).count();
+      if (it->second.heartbeat) {
+        m.deliveredHeartbeats++;
+        m.heartbeatFanoutMs.add(ms);
+      } else {
+        m.deliveredAlerts++;
+        m.alertFanoutMs.add(ms);
+      }
+    }
+  }
+}
+
+// -------------------------------------------------------------------------
+// REPORT
+// -------------------------------------------------------------------------
+static void printLatency(const char* name, sim::LatencyStats& s) {
+  printf("  %-30s n=%-7zu p50=%9.1f  p95=%9.1f  p99=%9.1f  max=%9.1f ms\n", name, s.count(),
+         s.percentile(50), s.percentile(95), s.percentile(99), s.max());
+}
+
+static void printReport(const Options& opt, sim::Metrics& m, const sim::BackendPool& pool, size_t dashboards,
+                        double wallSec) {
+  double virtualSec = opt.durationSec;
+  uint64_t backendRequests = m.alertPostOk + m.alertPostFail + m.heartbeatOk + m.heartbeatFail;
+
+  printf("\n========================================\n");
+  printf("   WBAN FLEET SIMULATION REPORT\n");
+  printf("========================================\n");
+  printf("Fleet:     %d watches, %.0f s virtual in %.2f s wall (%.0fx real time per watch, %.0fx fleet)\n",
+         opt.watches, virtualSec, wallSec, virtualSec / wallSec, virtualSec * opt.watches / wallSec);
+  printf("Backend:   %s%s\n", opt.backend.empty() ? "none (dry run, requests succeed in 40 ms)" : opt.backend.c_str(),
+         opt.stubBackend ? " (in-process stub)" : "");
+
+  printf("\n--- ⏱️ Boot ---\n");
+  printLatency("time to armed", m.armedMs);
+
+  printf("\n--- 🚨 Alerts (virtual time from event to caregiver SMS) ---\n");
+  printf("  injected: %llu falls, %llu squeezes, %llu SOS\n", (unsigned long long)m.injectedFalls,
+         (unsigned long long)m.injectedSqueezes, (unsigned long long)m.injectedSos);
+  printf("  SMS sent: %llu via GSM, %llu via Twilio, %llu false alarms\n", (unsigned long long)m.smsViaGsm,
+         (unsigned long long)m.smsViaTwilio, (unsigned long long)m.falseAlarms);
+  printf("  delivered: AI %llu/%llu, SOS %llu/%llu\n", (unsigned long long)m.matchedAi,
+         (unsigned long long)(m.injectedFalls + m.injectedSqueezes), (unsigned long long)m.matchedSos,
+         (unsigned long long)m.injectedSos);
+  printf("  undelivered: %llu still queued for retry, %llu lost\n", (unsigned long long)m.queuedAlerts,
+         (unsigned long long)m.lostAlerts);
+  printLatency("fall/squeeze -> SMS", m.aiAlertMs);
+  printLatency("double-press -> SMS", m.sosAlertMs);
+
+  printf("\n--- 🌐 Backend traffic ---\n");
+  printf("  alerts:     %llu ok, %llu failed\n", (unsigned long long)m.alertPostOk, (unsigned long long)m.alertPostFail);
+  printf("  heartbeats: %llu ok, %llu failed\n", (unsigned long long)m.heartbeatOk, (unsigned long long)m.heartbeatFail);
+  printf("  requests attempted with WiFi down: %llu\n", (unsigned long long)m.offlineHttpAttempts);
+  if (!opt.backend.empty()) {
+    double busy = pool.busySec();
+    printf("  concurrency: up to %d in flight (peak %d, mean %.1f)\n", pool.concurrency(), pool.peakInFlight(),
+           busy > 0 ? m.backendRttSec / busy : 0.0);
+    printf("  throughput:  %.1f req/s over %.2f s of backend activity\n", busy > 0 ? backendRequests / busy : 0.0, busy);
+    printLatency("POST alert round trip", m.alertWallMs);
+    printLatency("POST telemetry round trip", m.heartbeatWallMs);
+
+    printf("\n--- 📣 Dashboard fan-out (%zu socket.io subscribers) ---\n", dashboards);
+    if (dashboards == 0) {
+      printf("  not measured\n");
+    } else {
+      uint64_t postedAlerts = 0;
+      for (const auto& p : m.posted) postedAlerts += p.second.heartbeat ? 0 : 1;
+      uint64_t postedHeartbeats = m.posted.size() - postedAlerts;
+      printf("  received: %llu/%llu alerts, %llu/%llu heartbeats\n",
+             (unsigned long long)m.deliveredAlerts, (unsigned long long)(postedAlerts * dashboards),
+             (unsigned long long)m.deliveredHeartbeats, (unsigned long long)(postedHeartbeats * dashboards));
+      printLatency("POST sent -> new-panic-alert", m.alertFanoutMs);
+      printLatency("POST sent -> new-telemetry", m.heartbeatFanoutMs);
+    }
+  }
+
+  printf("\n--- ⌚ Firmware ---\n");
+  printLatency("longest IMU blackout", m.maxSampleGapMs);
+  printf("  classifier windows with another watch's samples: %llu\n", (unsigned long long)m.foreignWindows);
+  printf("----------------------------------------\n");
+}
+
+// -------------------------------------------------------------------------
+// MAIN
+// -------------------------------------------------------------------------
+int main(int argc, char** argv) {
+  Options opt;
+  if (!parseArgs(argc, argv, opt)) return 2;
+
+  sim::Metrics metrics;
+  sim::StubBackend stub;
+  if (opt.stubBackend) {
+    if (!stub.start()) {
+      fprintf(stderr, "❌ Cannot listen on a loopback port for --stub-backend\n");
+      return 2;
+    }
+    opt.backend = stub.hostPort();
+  }
+  sim::BackendPool pool;
+  if (!opt.backend.empty() && !pool.start(opt.backend, opt.httpConcurrency)) {
+    fprintf(stderr, "❌ Cannot resolve backend %s (expected host:port)\n", opt.backend.c_str());
+    return 2;
+  }
+  Dashboards dashboards = connectDashboards(opt);
+
+  // 1. Power on the fleet, staggered like a building-wide power restore
+  std::vector<Watch> fleet(opt.watches);
+  for (int i = 0; i < opt.watches; i++) {
+    uint64_t seed = mix(opt.seed + (uint64_t)i);
+    sim::Device& d = fleet[i].device;
+    d.reset(i, seed, secToUs(opt.bootSpreadSec) == 0 ? 0 : seed % secToUs(opt.bootSpreadSec));
+    d.pollCostUs = opt.pollUs;
+    d.modemPresent = opt.gsm;
+    d.verbose = (i == opt.traceWatch);
+    d.metrics = &metrics;
+    d.backend = opt.backend.empty() ? nullptr : &pool;
+    if (!createFiber(fleet[i])) {
+      fprintf(stderr, "❌ Out of memory for watch fibers\n");
+      return 2;
+    }
+  }
+
+  // 2. Script the world
+  if (!opt.scenario.empty() && !loadScenario(opt.scenario, fleet, metrics)) return 2;
+  addRandomEvents(fleet, metrics, opt);
+  for (Watch& w : fleet) w.device.finalizeScript();
+
+  // 3. Run: always step the watch that is furthest behind
+  typedef std::pair<uint64_t, int> Event;
+  std::priority_queue<Event, std::vector<Event>, std::greater<Event>> events;
+  for (int i = 0; i < opt.watches; i++) events.push({fleet[i].device.nowUs, i});
+
+  const uint64_t endUs = secToUs(opt.durationSec);
+  uint64_t nextProgressUs = endUs / 10;
+  auto wallStart = std::chrono::steady_clock::now();
+
+  size_t parked = 0;
+
+  while (!events.empty() || parked > 0) {
+    // Wake watches whose backend response is in; block only when nothing
+    // else can run
+    if (parked > 0) {
+      for (sim::BackendRequest* req : pool.collect(events.empty())) {
+        Watch& w = fleet[((sim::Device*)req->owner)->id];
+        w.parked = false;
+        parked--;
+        events.push({w.device.nowUs, w.device.id});
+      }
+    }
+    if (events.empty()) continue;
+
+    Event ev = events.top();
+    events.pop();
+    Watch& w = fleet[ev.second];
+
+    if (ev.first >= nextProgressUs) {
+      fprintf(stderr, "[SIM] %3.0f%% (t=%.0f s)\n", 100.0 * ev.first / endUs, ev.first / 1e6);
+      nextProgressUs += endUs / 10;
+    }
+
+    uint64_t before = w.device.nowUs;
+    resume(w);
+    if (w.parked) {
+      parked++;
+      continue;
+    }
+    if (w.device.nowUs == before) w.device.nowUs += 1000;
+    if (w.device.nowUs < endUs) events.push({w.device.nowUs, ev.second});
+  }
+  pool.stop();
+
+  double wallSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+  collectFanout(dashboards, metrics);
+
+  // 4. Per-watch results
+  for (Watch& w : fleet) {
+    if (w.firmware.boot.armed) metrics.armedMs.add((double)w.firmware.boot.armedAt);
+    metrics.maxSampleGapMs.add(w.device.maxSampleGapUs / 1000.0);
+    // The firmware retries one alert per watch; anything else it dropped
+    uint64_t queued = std::min<uint64_t>(w.firmware.connectivity.alertPending() ? 1 : 0, w.device.undelivered());
+    metrics.queuedAlerts += queued;
+    metrics.lostAlerts += w.device.undelivered() - queued;
+  }
+  printReport(opt, metrics, pool, dashboards.size(), wallSec);
+  for (Watch& w : fleet) munmap(w.stack, FIBER_STACK_BYTES);
+
+  // 5. Gates for CI
+  int status = 0;
+  if (metrics.foreignWindows > 0) {
+    printf("❌ %llu classifier windows mixed samples from several watches (firmware state not swapped)\n",
+           (unsigned long long)metrics.foreignWindows);
+    status = 1;
+  }
+  if (opt.minDetection >= 0.0) {
+    uint64_t injected = metrics.injectedFalls + metrics.injectedSqueezes + metrics.injectedSos;
+    uint64_t delivered = metrics.matchedAi + metrics.matchedSos;
+    double rate = injected ? (double)delivered / injected : 1.0;
+    if (rate < opt.minDetection) {
+      printf("❌ Delivered %.3f of injected events, below --min-detection %.3f\n", rate, opt.minDetection);
+      status = 1;
+    }
+  }
+  if (opt.maxArmedMs >= 0) {
+    if (metrics.armedMs.count() < (size_t)opt.watches) {
+      printf("❌ %zu of %d watches never armed\n", opt.watches - metrics.armedMs.count(), opt.watches);
+      status = 1;
+    } else if (metrics.armedMs.max() > opt.maxArmedMs) {
+      printf("❌ Slowest watch armed in %.0f ms, above --max-armed-ms %ld\n", metrics.armedMs.max(), opt.maxArmedMs);
+      status = 1;
+    }
+  }
+  if (opt.minAlertPosts >= 0 && metrics.alertPostOk < (uint64_t)opt.minAlertPosts) {
+    printf("❌ %llu alerts reached the backend, below --min-alert-posts %ld\n",
+           (unsigned long long)metrics.alertPostOk, opt.minAlertPosts);
+    status = 1;
+  }
+  if (opt.minFanout >= 0.0) {
+    uint64_t expected = metrics.posted.size() * dashboards.size();
+    uint64_t received = metrics.deliveredAlerts + metrics.deliveredHeartbeats;
+    if (dashboards.empty()) {
+      printf("❌ No dashboard subscriber connected, fan-out not measured\n");
+      status = 1;
+    } else if (expected > 0 && (double)received / expected < opt.minFanout) {
+      printf("❌ Dashboards received %llu of %llu broadcasts, below --min-fanout %.3f\n",
+             (unsigned long long)received, (unsigned long long)expected, opt.minFanout);
+      status = 1;
+    }
+  }
+  if (opt.maxFalseAlarms >= 0 && metrics.falseAlarms > (uint64_t)opt.maxFalseAlarms) {
+    printf("❌ %llu false alarms, above --max-false-alarms %ld\n", (unsigned long long)metrics.falseAlarms,
+           opt.maxFalseAlarms);
+    status = 1;
+  }
+  if (status == 0) printf("✅ Simulation passed\n");
+  return status;
+}
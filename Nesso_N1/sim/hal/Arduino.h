@@ -0,0 +1,42 @@
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+// Host-native Arduino core for the fleet simulator. Time, GPIO and
+// peripherals are routed to sim::current(), the watch being stepped.
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include "WString.h"
+#include "HardwareSerial.h"
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+// --- TIME (virtual clock, counted from this watch's reset) ---
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+
+// --- GPIO ---
+void pinMode(int pin, int mode);
+void digitalWrite(int pin, int value);
+int digitalRead(int pin);
+
+// --- SNTP (esp32-hal-time) ---
+void configTime(long gmtOffset_sec, int daylightOffset_sec, const char* server1,
+                const char* server2 = nullptr, const char* server3 = nullptr);
+bool getLocalTime(struct tm* info, uint32_t ms = 5000);
+
+class EspClass {
+  public:
+    uint32_t getFreeHeap() { return 256 * 1024; }
+};
+
+extern EspClass ESP;
+
+#endif
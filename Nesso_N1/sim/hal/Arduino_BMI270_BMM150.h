@@ -0,0 +1,16 @@
+#ifndef ARDUINO_BMI270_BMM150_H
+#define ARDUINO_BMI270_BMM150_H
+
+#include <Arduino.h>
+
+// IMU shim: samples come from the current watch's scripted motion trace
+class BoschSensorClass {
+  public:
+    int begin() { return 1; }
+    int accelerationAvailable() { return 1; }
+    int readAcceleration(float& x, float& y, float& z);
+};
+
+extern BoschSensorClass IMU;
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef ARDUINO_NESSO_N1_H
+#define ARDUINO_NESSO_N1_H
+
+#include <Arduino.h>
+
+// Expander pins on the real board; any unique number works here
+#define KEY1 100
+#define KEY2 101
+#define LCD_BACKLIGHT 102
+
+// Battery gauge backed by the current watch's discharge model
+class NessoBattery {
+  public:
+    enum ChargeStatus { NOT_CHARGING = 0, CHARGING = 1, FULL = 2 };
+
+    void begin() {}
+    void enableCharge() {}
+    int getChargeLevel();
+    float getVoltage();
+    ChargeStatus getChargeStatus() { return NOT_CHARGING; }
+};
+
+#endif
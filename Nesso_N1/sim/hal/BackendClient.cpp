@@ -0,0 +1,159 @@
+#include "BackendClient.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <netdb.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include "HTTPClient.h"
+
+namespace sim {
+
+bool BackendClient::configure(const std::string& spec) {
+  size_t colon = spec.rfind(':');
+  if (colon == std::string::npos) return false;
+  hostPort = spec;
+  host = spec.substr(0, colon);
+  std::string port = spec.substr(colon + 1);
+
+  addrinfo hints{};
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  addrinfo* res = nullptr;
+  if (getaddrinfo(host.c_str(), port.c_str(), &hints, &res) != 0 || !res) return false;
+  memcpy(&addr, res->ai_addr, res->ai_addrlen);
+  addrLen = res->ai_addrlen;
+  freeaddrinfo(res);
+  return true;
+}
+
+int BackendClient::openSocket(uint16_t timeoutMs) const {
+  int fd = socket(addr.ss_family, SOCK_STREAM, 0);
+  if (fd < 0) return -1;
+
+  timeval tv;
+  tv.tv_sec = timeoutMs / 1000;
+  tv.tv_usec = (timeoutMs % 1000) * 1000;
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+  setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+
+  if (connect(fd, (const sockaddr*)&addr, addrLen) != 0) {
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+int BackendClient::post(const std::string& path, const std::string& body, uint16_t timeoutMs, double& wallMs) const {
+  auto start = std::chrono::steady_clock::now();
+  auto finish = [&](int code) {
+    wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return code;
+  };
+
+  int fd = openSocket(timeoutMs);
+  if (fd < 0) return finish(HTTPC_ERROR_CONNECTION_REFUSED);
+
+  std::string request = "POST " + path + " HTTP/1.1\r\n"
+                        "Host: " + hostPort + "\r\n"
+                        "Content-Type: application/json\r\n"
+                        "Content-Length: " + std::to_string(body.size()) + "\r\n"
+                        "Connection: close\r\n\r\n" + body;
+  size_t sent = 0;
+  while (sent < request.size()) {
+    ssize_t n = send(fd, request.data() + sent, request.size() - sent, MSG_NOSIGNAL);
+    if (n <= 0) { close(fd); return finish(HTTPC_ERROR_CONNECTION_REFUSED); }
+    sent += (size_t)n;
+  }
+
+  // Read to EOF (Connection: close) so the round trip covers the whole
+  // response; only the status line matters, "HTTP/1.1 201 Created"
+  std::string response;
+  char buf[512];
+  for (;;) {
+    ssize_t n = recv(fd, buf, sizeof(buf), 0);
+    if (n <= 0) break;
+    response.append(buf, (size_t)n);
+  }
+  close(fd);
+
+  size_t space = response.find(' ');
+  if (space == std::string::npos) return finish(HTTPC_ERROR_READ_TIMEOUT);
+  return finish(atoi(response.c_str() + space + 1));
+}
+
+// -------------------------------------------------------------------------
+// WORKER POOL
+// -------------------------------------------------------------------------
+bool BackendPool::start(const std::string& hostPort, int concurrency) {
+  if (concurrency < 1 || !client.configure(hostPort)) return false;
+  workerCount = concurrency;
+  for (int i = 0; i < concurrency; i++) workers.emplace_back(&BackendPool::work, this);
+  return true;
+}
+
+void BackendPool::stop() {
+  {
+    std::lock_guard<std::mutex> lock(mu);
+    stopping = true;
+  }
+  workReady.notify_all();
+  for (std::thread& t : workers) t.join();
+  workers.clear();
+}
+
+void BackendPool::submit(BackendRequest* req) {
+  req->seq = nextSeq++;
+  if (!req->body.empty() && req->body[0] == '{') {
+    bool emptyObject = req->body.size() > 1 && req->body[1] == '}';
+    req->body.insert(1, "\"simSeq\":" + std::to_string(req->seq) + (emptyObject ? "" : ","));
+  }
+  {
+    std::lock_guard<std::mutex> lock(mu);
+    queued.push_back(req);
+  }
+  workReady.notify_one();
+}
+
+std::vector<BackendRequest*> BackendPool::collect(bool wait) {
+  std::unique_lock<std::mutex> lock(mu);
+  if (wait) doneReady.wait(lock, [this] { return !finished.empty(); });
+  std::vector<BackendRequest*> out;
+  out.swap(finished);
+  return out;
+}
+
+double BackendPool::busySec() const {
+  if (!anySent) return 0.0;
+  return std::chrono::duration<double>(lastDone - firstSend).count();
+}
+
+void BackendPool::work() {
+  for (;;) {
+    BackendRequest* req;
+    {
+      std::unique_lock<std::mutex> lock(mu);
+      workReady.wait(lock, [this] { return stopping || !queued.empty(); });
+      if (queued.empty()) return;
+      req = queued.front();
+      queued.pop_front();
+      inFlight++;
+      peak = std::max(peak, inFlight);
+      if (!anySent) { anySent = true; firstSend = std::chrono::steady_clock::now(); }
+    }
+
+    req->sentAt = std::chrono::steady_clock::now();
+    req->code = client.post(req->path, req->body, req->timeoutMs, req->wallMs);
+
+    {
+      std::lock_guard<std::mutex> lock(mu);
+      inFlight--;
+      lastDone = std::chrono::steady_clock::now();
+      finished.push_back(req);
+    }
+    doneReady.notify_one();
+  }
+}
+
+}
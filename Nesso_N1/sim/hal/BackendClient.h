@@ -0,0 +1,97 @@
+#ifndef SIM_BACKEND_CLIENT_H
+#define SIM_BACKEND_CLIENT_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <vector>
+
+namespace sim {
+
+// Minimal blocking HTTP/1.1 client for driving a real backend instance.
+// One connection per request, exactly like the firmware's HTTPClient.
+class BackendClient {
+  public:
+    // "host:port"; returns false if the host cannot be resolved
+    bool configure(const std::string& hostPort);
+    const std::string& target() const { return hostPort; }
+
+    // Connected TCP socket with send/receive timeouts set, or -1
+    int openSocket(uint16_t timeoutMs) const;
+
+    // POSTs JSON to path. Returns the HTTP status code, or a negative
+    // HTTPC_ERROR_* code, and the wall-clock round trip in wallMs.
+    // Thread-safe: the resolved address is only read.
+    int post(const std::string& path, const std::string& body, uint16_t timeoutMs, double& wallMs) const;
+
+  private:
+    std::string hostPort;
+    std::string host;
+    sockaddr_storage addr{};
+    socklen_t addrLen = 0;
+};
+
+// One firmware HTTP call travelling through the pool. The watch that made
+// it stays parked until the pool hands the request back.
+struct BackendRequest {
+  std::string path;
+  std::string body;
+  uint16_t timeoutMs = 5000;
+  void* owner = nullptr;
+  uint64_t seq = 0;      // "simSeq" tag carried in the JSON body
+  std::chrono::steady_clock::time_point sentAt;
+  int code = 0;
+  double wallMs = 0.0;  // send -> response, not counting time queued in the pool
+};
+
+// Worker pool that keeps up to `concurrency` requests in flight against the
+// backend, one connection each. The scheduler submits from the main thread
+// and collects finished requests without ever blocking on the network
+// while there are other watches to step.
+class BackendPool {
+  public:
+    ~BackendPool() { stop(); }
+
+    bool start(const std::string& hostPort, int concurrency);
+    void stop();
+
+    // Tags the JSON body with a unique "simSeq" so dashboard subscribers
+    // can match the broadcast back to this request, then queues it
+    void submit(BackendRequest* req);
+    // Finished requests. With wait, blocks until at least one is available.
+    std::vector<BackendRequest*> collect(bool wait);
+
+    const std::string& target() const { return client.target(); }
+    int concurrency() const { return workerCount; }
+    int peakInFlight() const { return peak; }
+    // Wall time from the first request sent to the last response received
+    double busySec() const;
+
+  private:
+    BackendClient client;
+    std::vector<std::thread> workers;
+    std::mutex mu;
+    std::condition_variable workReady;
+    std::condition_variable doneReady;
+    std::deque<BackendRequest*> queued;
+    std::vector<BackendRequest*> finished;
+    bool stopping = false;
+    int workerCount = 0;
+    uint64_t nextSeq = 1;
+    int inFlight = 0;
+    int peak = 0;
+    bool anySent = false;
+    std::chrono::steady_clock::time_point firstSend;
+    std::chrono::steady_clock::time_point lastDone;
+
+    void work();
+};
+
+}
+
+#endif
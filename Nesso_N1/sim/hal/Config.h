@@ -0,0 +1,61 @@
+#ifndef CONFIG_H
+#define CONFIG_H
+
+// Simulator defaults, used only when the firmware directory has no
+// Config.h of its own. Every value can be overridden with -D at configure
+// time, e.g. -DUPLOAD_RATE=10000 for a heartbeat-heavy load test.
+
+#ifndef WIFI_SSID
+#define WIFI_SSID "wban-sim"
+#endif
+#ifndef WIFI_PASS
+#define WIFI_PASS "wban-sim"
+#endif
+
+#ifndef TWILIO_ACCOUNT_SID
+#define TWILIO_ACCOUNT_SID "ACsimulator"
+#endif
+#ifndef TWILIO_AUTH_TOKEN
+#define TWILIO_AUTH_TOKEN "simulator"
+#endif
+#ifndef TWILIO_FROM_NUM
+#define TWILIO_FROM_NUM "+10000000000"
+#endif
+
+// The HAL sends plain HTTP to the simulator's --backend, whatever this says
+#ifndef SERVER_IP
+#define SERVER_IP "127.0.0.1"
+#endif
+#ifndef SERVER_PORT
+#define SERVER_PORT 3000
+#endif
+#ifndef API_ENDPOINT
+#define API_ENDPOINT "/api/alert"
+#endif
+
+#ifndef SERIAL_DEBUG
+#define SERIAL_DEBUG true
+#endif
+
+#ifndef NETWORK_CHECK_RATE
+#define NETWORK_CHECK_RATE 10000
+#endif
+#ifndef UPLOAD_RATE
+#define UPLOAD_RATE 300000
+#endif
+#ifndef BATTERY_CHECK_RATE
+#define BATTERY_CHECK_RATE 60000
+#endif
+#ifndef SCREEN_TIMEOUT
+#define SCREEN_TIMEOUT 15000
+#endif
+#ifndef BATTERY_LOW_ALARM
+#define BATTERY_LOW_ALARM 15
+#endif
+#ifndef STEP_THRESHOLD
+#define STEP_THRESHOLD 1.8
+#endif
+
+enum Page { PAGE_CLOCK, PAGE_SAFETY_CHECK, PAGE_INFO, PAGE_PANIC, PAGE_LOW_BATT };
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef DNN_1_DATASET_INFERENCING_H
+#define DNN_1_DATASET_INFERENCING_H
+
+// Stand-in for the Edge Impulse export. The real model cannot run on the
+// host, so run_classifier() is a rule-based detector with the same labels
+// and window shape: 2 s at 50 Hz of (ax, ay, az, dress pressure).
+//  - fall:    an impact peak above 2.5 g followed by a horizontal posture
+//             (or a peak at the very end of the window)
+//  - squeeze: mean dress pressure above 2500 across the window
+// It also charges the watch's virtual clock for DSP + inference time.
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#define EI_CLASSIFIER_RAW_SAMPLE_COUNT 100
+#define EI_CLASSIFIER_RAW_SAMPLES_PER_FRAME 4
+#define EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE (EI_CLASSIFIER_RAW_SAMPLE_COUNT * EI_CLASSIFIER_RAW_SAMPLES_PER_FRAME)
+#define EI_CLASSIFIER_INTERVAL_MS 20
+#define EI_CLASSIFIER_LABEL_COUNT 2
+
+typedef enum {
+  EI_IMPULSE_OK = 0,
+  EI_IMPULSE_ERROR_SHAPES_DONT_MATCH = -1
+} EI_IMPULSE_ERROR;
+
+typedef struct {
+  const char* label;
+  float value;
+} ei_impulse_result_classification_t;
+
+typedef struct {
+  int sampling;
+  int dsp;
+  int classification;
+  int anomaly;
+} ei_impulse_result_timing_t;
+
+typedef struct {
+  ei_impulse_result_classification_t classification[EI_CLASSIFIER_LABEL_COUNT];
+  float anomaly;
+  ei_impulse_result_timing_t timing;
+} ei_impulse_result_t;
+
+namespace ei {
+  typedef struct {
+    std::function<int(size_t offset, size_t length, float* out_ptr)> get_data;
+    size_t total_length;
+  } signal_t;
+}
+using ei::signal_t;
+
+EI_IMPULSE_ERROR run_classifier(signal_t* signal, ei_impulse_result_t* result, bool debug = false);
+
+#endif
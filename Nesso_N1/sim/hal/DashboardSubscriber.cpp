@@ -0,0 +1,203 @@
+#include "DashboardSubscriber.h"
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "base64.h"
+
+namespace sim {
+
+// WebSocket opcodes (RFC 6455)
+static const uint8_t WS_CONTINUATION = 0x0;
+static const uint8_t WS_TEXT = 0x1;
+static const uint8_t WS_CLOSE = 0x8;
+static const uint8_t WS_PING = 0x9;
+static const uint8_t WS_PONG = 0xA;
+
+bool DashboardSubscriber::start(const std::string& hostPort, uint16_t timeoutMs) {
+  if (!client.configure(hostPort)) return false;
+  fd = client.openSocket(timeoutMs);
+  if (fd < 0) return false;
+  if (!handshake(timeoutMs)) {
+    close(fd);
+    fd = -1;
+    return false;
+  }
+
+  // Short receive timeout from here on so the reader notices stop()
+  timeval tv{0, 200000};
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+  reader = std::thread(&DashboardSubscriber::read, this);
+
+  std::unique_lock<std::mutex> lock(mu);
+  if (!joinedReady.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this] { return joined; })) {
+    lock.unlock();
+    stop();
+    return false;
+  }
+  return true;
+}
+
+void DashboardSubscriber::stop() {
+  stopping = true;
+  if (reader.joinable()) reader.join();
+  if (fd >= 0) {
+    close(fd);
+    fd = -1;
+  }
+}
+
+size_t DashboardSubscriber::received() {
+  std::lock_guard<std::mutex> lock(mu);
+  return log.size();
+}
+
+std::vector<Delivery> DashboardSubscriber::deliveries() {
+  std::lock_guard<std::mutex> lock(mu);
+  return log;
+}
+
+// -------------------------------------------------------------------------
+// WEBSOCKET
+// -------------------------------------------------------------------------
+bool DashboardSubscriber::handshake(uint16_t timeoutMs) {
+  std::random_device rd;
+  std::string nonce;
+  for (int i = 0; i < 16; i++) nonce += (char)('A' + rd() % 26);
+
+  std::string request = "GET /socket.io/?EIO=4&transport=websocket HTTP/1.1\r\n"
+                        "Host: " + client.target() + "\r\n"
+                        "Upgrade: websocket\r\n"
+                        "Connection: Upgrade\r\n"
+                        "Sec-WebSocket-Key: " + std::string(base64::encode(String(nonce)).c_str()) + "\r\n"
+                        "Sec-WebSocket-Version: 13\r\n\r\n";
+  if (send(fd, request.data(), request.size(), MSG_NOSIGNAL) != (ssize_t)request.size()) return false;
+
+  // "HTTP/1.1 101 Switching Protocols"; anything after the headers is
+  // already the first frame
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+  size_t headerEnd;
+  while ((headerEnd = rx.find("\r\n\r\n")) == std::string::npos) {
+    if (std::chrono::steady_clock::now() > deadline) return false;
+    char buf[512];
+    ssize_t n = recv(fd, buf, sizeof(buf), 0);
+    if (n <= 0) return false;
+    rx.append(buf, (size_t)n);
+  }
+  size_t space = rx.find(' ');
+  if (space == std::string::npos || atoi(rx.c_str() + space + 1) != 101) return false;
+  rx.erase(0, headerEnd + 4);
+  return true;
+}
+
+void DashboardSubscriber::read() {
+  char buf[4096];
+  while (!stopping) {
+    uint8_t opcode;
+    bool fin;
+    std::string payload;
+    while (nextFrame(opcode, fin, payload)) {
+      if (opcode == WS_PING) {
+        sendFrame(WS_PONG, payload);
+      } else if (opcode == WS_CLOSE) {
+        return;
+      } else if (opcode == WS_TEXT || opcode == WS_CONTINUATION) {
+        if (opcode == WS_TEXT) message.clear();
+        message += payload;
+        if (fin) onMessage(message);
+      }
+    }
+
+    ssize_t n = recv(fd, buf, sizeof(buf), 0);
+    if (n > 0) rx.append(buf, (size_t)n);
+    else if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) return;
+  }
+}
+
+bool DashboardSubscriber::nextFrame(uint8_t& opcode, bool& fin, std::string& payload) {
+  if (rx.size() < 2) return false;
+  const uint8_t* p = (const uint8_t*)rx.data();
+  fin = p[0] & 0x80;
+  opcode = p[0] & 0x0F;
+  bool masked = p[1] & 0x80;
+  uint64_t len = p[1] & 0x7F;
+  size_t pos = 2;
+  if (len == 126) {
+    if (rx.size() < 4) return false;
+    len = ((uint64_t)p[2] << 8) | p[3];
+    pos = 4;
+  } else if (len == 127) {
+    if (rx.size() < 10) return false;
+    len = 0;
+    for (int i = 0; i < 8; i++) len = (len << 8) | p[2 + i];
+    pos = 10;
+  }
+  uint8_t mask[4] = {0, 0, 0, 0};
+  if (masked) {
+    if (rx.size() < pos + 4) return false;
+    memcpy(mask, p + pos, 4);
+    pos += 4;
+  }
+  if (rx.size() < pos + len) return false;
+
+  payload.assign(rx, pos, (size_t)len);
+  if (masked) {
+    for (size_t i = 0; i < payload.size(); i++) payload[i] ^= mask[i % 4];
+  }
+  rx.erase(0, pos + (size_t)len);
+  return true;
+}
+
+// Client frames must be masked; the key itself does not matter
+void DashboardSubscriber::sendFrame(uint8_t opcode, const std::string& payload) {
+  static const uint8_t mask[4] = {0x5A, 0x3C, 0x96, 0xE1};
+  std::string frame;
+  frame += (char)(0x80 | opcode);
+  if (payload.size() < 126) {
+    frame += (char)(0x80 | payload.size());
+  } else {
+    frame += (char)(0x80 | 126);
+    frame += (char)((payload.size() >> 8) & 0xFF);
+    frame += (char)(payload.size() & 0xFF);
+  }
+  frame.append((const char*)mask, 4);
+  for (size_t i = 0; i < payload.size(); i++) frame += (char)(payload[i] ^ mask[i % 4]);
+  send(fd, frame.data(), frame.size(), MSG_NOSIGNAL);
+}
+
+// -------------------------------------------------------------------------
+// SOCKET.IO (ENGINE.IO V4 PACKETS)
+// -------------------------------------------------------------------------
+void DashboardSubscriber::onMessage(const std::string& text) {
+  auto now = std::chrono::steady_clock::now();
+  if (text.empty()) return;
+
+  switch (text[0]) {
+    case '0':  // Engine.IO open -> join the default namespace
+      sendFrame(WS_TEXT, "40");
+      break;
+    case '2':  // Engine.IO ping -> pong
+      sendFrame(WS_TEXT, "3");
+      break;
+    case '4':  // Engine.IO message carrying a socket.io packet
+      if (text.rfind("40", 0) == 0) {
+        std::lock_guard<std::mutex> lock(mu);
+        joined = true;
+        joinedReady.notify_all();
+      } else if (text.rfind("42", 0) == 0) {
+        // 42["new-panic-alert",{..."simSeq":17,...}]; events from real
+        // watches carry no tag and are ignored
+        size_t tag = text.find("\"simSeq\":");
+        if (tag == std::string::npos) break;
+        uint64_t seq = strtoull(text.c_str() + tag + 9, nullptr, 10);
+        std::lock_guard<std::mutex> lock(mu);
+        log.push_back({seq, now});
+      }
+      break;
+  }
+}
+
+}
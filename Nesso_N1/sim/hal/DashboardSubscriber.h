@@ -0,0 +1,58 @@
+#ifndef SIM_DASHBOARD_SUBSCRIBER_H
+#define SIM_DASHBOARD_SUBSCRIBER_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BackendClient.h"
+
+namespace sim {
+
+// One broadcast as seen by a dashboard, stamped on arrival
+struct Delivery {
+  uint64_t seq;  // "simSeq" of the POST that caused it
+  std::chrono::steady_clock::time_point at;
+};
+
+// Headless stand-in for the React dashboard: a socket.io client (Engine.IO
+// v4 over a raw WebSocket) that listens for new-panic-alert and
+// new-telemetry on its own thread and timestamps every event it receives.
+class DashboardSubscriber {
+  public:
+    ~DashboardSubscriber() { stop(); }
+
+    // Connects and joins the default namespace; false if the backend does
+    // not speak socket.io at host:port within timeoutMs
+    bool start(const std::string& hostPort, uint16_t timeoutMs = 3000);
+    void stop();
+
+    size_t received();
+    std::vector<Delivery> deliveries();
+
+  private:
+    BackendClient client;
+    int fd = -1;
+    std::thread reader;
+    std::atomic<bool> stopping{false};
+    std::mutex mu;
+    std::condition_variable joinedReady;
+    bool joined = false;
+    std::vector<Delivery> log;
+    std::string rx;       // bytes not yet parsed into frames
+    std::string message;  // text message being reassembled from fragments
+
+    bool handshake(uint16_t timeoutMs);
+    void read();
+    bool nextFrame(uint8_t& opcode, bool& fin, std::string& payload);
+    void sendFrame(uint8_t opcode, const std::string& payload);
+    void onMessage(const std::string& text);
+};
+
+}
+
+#endif
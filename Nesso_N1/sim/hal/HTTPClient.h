@@ -0,0 +1,29 @@
+#ifndef HTTPCLIENT_H
+#define HTTPCLIENT_H
+
+#include <WiFi.h>
+
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTPC_ERROR_READ_TIMEOUT (-11)
+
+// Plain HTTP goes to the backend given to the simulator (whatever host the
+// firmware config names); HTTPS goes to the Twilio mock.
+class HTTPClient {
+  public:
+    bool begin(WiFiClient& client, const String& url) {
+      requestUrl = url;
+      secure = client.isSecure();
+      return true;
+    }
+    void addHeader(const String& name, const String& value) { (void)name; (void)value; }
+    void setTimeout(uint16_t ms) { timeoutMs = ms; }
+    int POST(const String& payload);
+    void end() {}
+
+  private:
+    String requestUrl;
+    bool secure = false;
+    uint16_t timeoutMs = 5000;
+};
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef HARDWARESERIAL_H
+#define HARDWARESERIAL_H
+
+#include "Stream.h"
+
+#define SERIAL_8N1 0x800001c
+
+// UART shim. Port 0 is the USB console, port 1 is wired to the simulated
+// SIM800L modem of whichever watch is currently running.
+class HardwareSerial : public Stream {
+  public:
+    explicit HardwareSerial(int uartNum) : port(uartNum) {}
+
+    void begin(unsigned long baud, uint32_t config = SERIAL_8N1, int8_t rxPin = -1, int8_t txPin = -1) {
+      (void)baud; (void)config; (void)rxPin; (void)txPin;
+    }
+
+    using Print::write;
+    size_t write(uint8_t c) override;
+    bool enabled() override;
+    int available() override;
+    int read() override;
+
+    operator bool() const { return true; }
+
+  private:
+    int port;
+};
+
+extern HardwareSerial Serial;
+
+#endif
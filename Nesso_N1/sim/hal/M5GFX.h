@@ -0,0 +1,39 @@
+#ifndef M5GFX_H
+#define M5GFX_H
+
+#include <Arduino.h>
+
+enum textdatum_t { top_left = 0, middle_center = 4 };
+
+#define TFT_BLACK 0x0000
+#define TFT_WHITE 0xFFFF
+#define TFT_RED 0xF800
+#define TFT_GREEN 0x07E0
+#define TFT_BLUE 0x001F
+#define TFT_ORANGE 0xFDA0
+#define TFT_YELLOW 0xFFE0
+#define TFT_MAROON 0x7800
+#define TFT_DARKGREY 0x7BEF
+#define TFT_DARKGREEN 0x03E0
+#define TFT_GREENYELLOW 0xB7E0
+
+// Headless display: drawing is a no-op and the touch panel is never pressed.
+class M5GFX {
+  public:
+    bool begin() { return true; }
+    void setRotation(int r) { (void)r; }
+    void fillScreen(uint32_t color) { (void)color; }
+    void fillRect(int x, int y, int w, int h, uint32_t color) { (void)x; (void)y; (void)w; (void)h; (void)color; }
+    void fillCircle(int x, int y, int r, uint32_t color) { (void)x; (void)y; (void)r; (void)color; }
+    void setTextDatum(textdatum_t d) { (void)d; }
+    void setTextSize(int s) { (void)s; }
+    void setTextColor(uint32_t fg) { (void)fg; }
+    void setTextColor(uint32_t fg, uint32_t bg) { (void)fg; (void)bg; }
+    void setCursor(int x, int y) { (void)x; (void)y; }
+    void drawString(const String& s, int x, int y) { (void)s; (void)x; (void)y; }
+    void println(const char* s) { (void)s; }
+    void printf(const char* fmt, ...) { (void)fmt; }
+    bool getTouch(uint16_t* x, uint16_t* y) { (void)x; (void)y; return false; }
+};
+
+#endif
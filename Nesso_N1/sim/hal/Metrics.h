@@ -0,0 +1,79 @@
+#ifndef SIM_METRICS_H
+#define SIM_METRICS_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace sim {
+
+// Collects samples and reports percentiles once the run is over
+class LatencyStats {
+  public:
+    void add(double v) { samples.push_back(v); sorted = false; }
+    size_t count() const { return samples.size(); }
+
+    double percentile(double p) {
+      if (samples.empty()) return 0.0;
+      if (!sorted) { std::sort(samples.begin(), samples.end()); sorted = true; }
+      size_t idx = (size_t)(p / 100.0 * (samples.size() - 1) + 0.5);
+      return samples[std::min(idx, samples.size() - 1)];
+    }
+    double max() { return percentile(100.0); }
+
+  private:
+    std::vector<double> samples;
+    bool sorted = true;
+};
+
+// Fleet-wide counters, shared by every simulated watch
+struct Metrics {
+  // --- INJECTED BY THE SCENARIO ---
+  uint64_t injectedFalls = 0;
+  uint64_t injectedSqueezes = 0;
+  uint64_t injectedSos = 0;
+
+  // --- ALERTS THAT REACHED A CAREGIVER (SMS) ---
+  uint64_t smsViaGsm = 0;
+  uint64_t smsViaTwilio = 0;
+  uint64_t matchedAi = 0;     // fall/squeeze -> AI_FALL SMS
+  uint64_t matchedSos = 0;    // double-press -> MANUAL_SOS SMS
+  uint64_t falseAlarms = 0;   // SMS with no injected event to explain it
+  LatencyStats aiAlertMs;     // virtual ms from injection to SMS
+  LatencyStats sosAlertMs;
+  uint64_t queuedAlerts = 0;  // undelivered but still held in the Tier-3 retry at the end
+  uint64_t lostAlerts = 0;    // undelivered and no longer held anywhere
+
+  // --- BACKEND TRAFFIC ---
+  uint64_t alertPostOk = 0;
+  uint64_t alertPostFail = 0;
+  uint64_t heartbeatOk = 0;
+  uint64_t heartbeatFail = 0;
+  uint64_t offlineHttpAttempts = 0;  // firmware tried HTTP with WiFi down
+  LatencyStats alertWallMs;          // real round-trip to the backend
+  LatencyStats heartbeatWallMs;
+  double backendRttSec = 0.0;        // summed round trips (mean in flight = this / busy time)
+
+  // --- DASHBOARD FAN-OUT ---
+  // Accepted POSTs by simSeq; each should reach every dashboard subscriber
+  struct Posted {
+    std::chrono::steady_clock::time_point sentAt;
+    bool heartbeat;
+  };
+  std::unordered_map<uint64_t, Posted> posted;
+  uint64_t deliveredAlerts = 0;
+  uint64_t deliveredHeartbeats = 0;
+  LatencyStats alertFanoutMs;        // POST sent -> new-panic-alert received
+  LatencyStats heartbeatFanoutMs;    // POST sent -> new-telemetry received
+
+  // --- FIRMWARE BEHAVIOUR ---
+  LatencyStats armedMs;        // Boot.armedAt per watch
+  LatencyStats maxSampleGapMs; // longest IMU blackout per watch
+  uint64_t foreignWindows = 0; // classified windows not made of this watch's readings (simulator bug)
+};
+
+}
+
+#endif
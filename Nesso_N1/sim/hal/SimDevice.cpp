@@ -0,0 +1,356 @@
+#include "SimDevice.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include "BackendClient.h"
+#include "HTTPClient.h"
+#include "Arduino_Nesso_N1.h"
+
+namespace sim {
+
+Device* g_current = nullptr;
+
+// --- MOTION / DRESS MODEL ---
+static const uint64_t FREE_FALL_US = 300000;
+static const uint64_t IMPACT_US = 60000;
+static const uint64_t LYING_US = 30000000;
+static const uint64_t DRESS_PERIOD_US = 100000;
+static const int DRESS_IDLE_PRESSURE = 150;
+static const int DRESS_SQUEEZE_PRESSURE = 3500;
+
+// --- RADIO / MODEM MODEL ---
+static const uint64_t NTP_DELAY_US = 300000;
+static const size_t RECENT_READS = 128;         // IMU readings kept to check classifier windows
+static const uint64_t GPS_PERIOD_US = 1000000;
+static const uint64_t EPOCH_BASE_SEC = 1767225600; // 2026-01-01 00:00:00 UTC
+
+// Dress pressure packet as sent by the Velostat node
+struct DressPacket {
+  int pressureValue;
+};
+
+void Device::reset(int watchId, uint64_t seed, uint64_t powerOnUs) {
+  *this = Device();
+  id = watchId;
+  rng.seed(seed);
+  bootUs = powerOnUs;
+  nowUs = powerOnUs;
+  lastSampleUs = 0;
+  nextDressUs = powerOnUs + 500000;
+  gpsFixUs = powerOnUs + 30000000 + rng() % 60000000;  // cold start: 30-90 s
+  nextGpsUs = powerOnUs + GPS_PERIOD_US;
+  batteryAtBoot = 35 + (int)(rng() % 66);
+}
+
+void Device::finalizeScript() {
+  std::sort(falls.begin(), falls.end());
+  std::sort(sosPresses.begin(), sosPresses.end());
+
+  std::vector<uint64_t> ai(falls);
+  for (const Window& w : squeezes) ai.push_back(w.startUs);
+  std::sort(ai.begin(), ai.end());
+  pendingAi.assign(ai.begin(), ai.end());
+  pendingSos.assign(sosPresses.begin(), sosPresses.end());
+}
+
+bool Device::inAny(const std::vector<Window>& windows, uint64_t t) const {
+  for (const Window& w : windows) {
+    if (w.contains(t)) return true;
+  }
+  return false;
+}
+
+// -------------------------------------------------------------------------
+// CONSOLE / GPIO
+// -------------------------------------------------------------------------
+void Device::consoleWrite(uint8_t c) {
+  if (!verbose || c == '\r') return;
+  if (c != '\n') {
+    consoleLine += (char)c;
+    return;
+  }
+  printf("[w%04d %9.3fs] %s\n", id, (nowUs - bootUs) / 1e6, consoleLine.c_str());
+  consoleLine.clear();
+}
+
+// KEY1 is active-low; a scripted SOS is two 80 ms taps 250 ms apart
+int Device::readPin(int pin) const {
+  if (pin != KEY1) return 1;
+  auto it = std::upper_bound(sosPresses.begin(), sosPresses.end(), nowUs);
+  if (it == sosPresses.begin()) return 1;
+  uint64_t dt = nowUs - *(it - 1);
+  bool pressed = dt < 80000 || (dt >= 250000 && dt < 330000);
+  return pressed ? 0 : 1;
+}
+
+// -------------------------------------------------------------------------
+// IMU + SMART DRESS
+// -------------------------------------------------------------------------
+void Device::readAcceleration(float& x, float& y, float& z) {
+  if (lastSampleUs != 0) maxSampleGapUs = std::max(maxSampleGapUs, nowUs - lastSampleUs);
+  lastSampleUs = nowUs;
+
+  // ESP-NOW arrives asynchronously on the device; deliver the newest
+  // packet that is due so the callback sees the current pressure
+  if (espNowCb && nowUs >= nextDressUs) {
+    uint64_t slot = nextDressUs + (nowUs - nextDressUs) / DRESS_PERIOD_US * DRESS_PERIOD_US;
+    DressPacket pkt;
+    pkt.pressureValue = inAny(squeezes, slot) ? DRESS_SQUEEZE_PRESSURE
+                                              : DRESS_IDLE_PRESSURE + (int)(rng() % 40);
+    espNowCb(nullptr, (const uint8_t*)&pkt, sizeof(pkt));
+    nextDressUs = slot + DRESS_PERIOD_US;
+  }
+
+  uint64_t sinceFall = UINT64_MAX;
+  auto it = std::upper_bound(falls.begin(), falls.end(), nowUs);
+  if (it != falls.begin()) sinceFall = nowUs - *(it - 1);
+
+  if (sinceFall < FREE_FALL_US) {
+    x = 0.05f; y = 0.05f; z = 0.15f;
+  } else if (sinceFall < FREE_FALL_US + IMPACT_US) {
+    x = 2.1f; y = 1.6f; z = 2.4f;
+  } else if (sinceFall < FREE_FALL_US + IMPACT_US + LYING_US) {
+    x = 0.97f; y = 0.08f; z = 0.12f;      // lying on one side
+  } else {
+    double t = nowUs / 1e6;                // upright, walking at ~1.8 steps/s
+    x = 0.10f * (float)sin(2 * M_PI * 1.8 * t);
+    y = 0.05f;
+    z = 1.0f + 0.25f * (float)sin(2 * M_PI * 1.8 * t + 0.5);
+  }
+
+  x += noise(rng);
+  y += noise(rng);
+  z += noise(rng);
+  recentReads.push_back({x, y, z});
+  if (recentReads.size() > RECENT_READS) recentReads.pop_front();
+}
+
+bool Device::servedWindow(const float* frame, size_t samples, size_t stride) const {
+  if (samples > recentReads.size()) return false;
+  size_t first = recentReads.size() - samples;
+  for (size_t i = 0; i < samples; i++) {
+    const std::array<float, 3>& r = recentReads[first + i];
+    const float* s = frame + i * stride;
+    if (s[0] != r[0] || s[1] != r[1] || s[2] != r[2]) return false;
+  }
+  return true;
+}
+
+// -------------------------------------------------------------------------
+// WIFI / NTP / HTTP
+// -------------------------------------------------------------------------
+void Device::wifiBegin() {
+  wifiAssocUs = nowUs + 1500000 + rng() % 2500000;  // 1.5-4 s to associate
+}
+
+// Connected once associated, unless an outage has hit the link since
+bool Device::wifiConnected() const {
+  if (nowUs < wifiAssocUs) return false;
+  for (const Window& w : wifiOutages) {
+    if (w.overlaps(wifiAssocUs, nowUs)) return false;
+  }
+  return true;
+}
+
+void Device::ntpConfigure(long gmtOffsetSec) {
+  gmtOffset = gmtOffsetSec;
+  if (wifiConnected()) ntpSyncedUs = nowUs + NTP_DELAY_US;
+}
+
+bool Device::ntpTime(struct tm* info) {
+  if (nowUs < ntpSyncedUs) return false;
+  time_t t = (time_t)(EPOCH_BASE_SEC + nowUs / 1000000 + gmtOffset);
+  gmtime_r(&t, info);
+  return true;
+}
+
+bool Device::ntpSyncCompleted() {
+  if (nowUs < ntpSyncedUs || ntpSyncReported) return false;
+  ntpSyncReported = true;
+  return true;
+}
+
+int Device::httpPost(const std::string& url, bool secure, const std::string& body, uint16_t timeoutMs) {
+  if (!wifiConnected()) {
+    metrics->offlineHttpAttempts++;
+    advanceMs(50);
+    return HTTPC_ERROR_CONNECTION_REFUSED;
+  }
+
+  // Twilio mock: accepted after a typical TLS + API round trip
+  if (secure) {
+    advanceMs(700);
+    recordSms(false, body);
+    return 201;
+  }
+
+  size_t hostStart = url.find("://");
+  size_t pathStart = url.find('/', hostStart == std::string::npos ? 0 : hostStart + 3);
+  std::string path = pathStart == std::string::npos ? "/" : url.substr(pathStart);
+  bool heartbeat = path.find("telemetry") != std::string::npos;
+
+  int code;
+  if (inAny(backendOutages, nowUs)) {
+    advanceMs(timeoutMs);
+    code = HTTPC_ERROR_READ_TIMEOUT;
+  } else if (backend) {
+    // Other watches keep running while this one waits on the wire; the
+    // firmware then sees the measured round trip as time spent blocking
+    BackendRequest req;
+    req.path = path;
+    req.body = body;
+    req.timeoutMs = timeoutMs;
+    req.owner = this;
+    backend->submit(&req);
+    park();
+    code = req.code;
+    nowUs += (uint64_t)(std::min(req.wallMs, (double)timeoutMs) * 1000.0);
+    metrics->backendRttSec += req.wallMs / 1000.0;
+    (heartbeat ? metrics->heartbeatWallMs : metrics->alertWallMs).add(req.wallMs);
+    if (code == 200 || code == 201) metrics->posted[req.seq] = {req.sentAt, heartbeat};
+  } else {
+    // Dry run: no backend, every request succeeds unless the backend's
+    // JSON parser would reject it (raw control characters inside strings)
+    advanceMs(40);
+    bool control = std::any_of(body.begin(), body.end(), [](char c) { return (unsigned char)c < 0x20; });
+    code = control ? 400 : 201;
+  }
+
+  bool ok = (code == 200 || code == 201);
+  if (heartbeat) (ok ? metrics->heartbeatOk : metrics->heartbeatFail)++;
+  else (ok ? metrics->alertPostOk : metrics->alertPostFail)++;
+  return code;
+}
+
+// -------------------------------------------------------------------------
+// SIM800L MODEM (AT COMMANDS OVER UART 1)
+// -------------------------------------------------------------------------
+void Device::modemReply(uint64_t delayMs, const std::string& text) {
+  modemRx.push_back({nowUs + delayMs * 1000, text});
+}
+
+void Device::modemCommand(const std::string& cmd) {
+  bool registered = !inAny(gsmOutages, nowUs);
+
+  if (cmd.rfind("AT+CREG?", 0) == 0) {
+    modemReply(200, registered ? "\r\n+CREG: 0,1\r\n\r\nOK\r\n" : "\r\n+CREG: 0,0\r\n\r\nOK\r\n");
+  } else if (cmd.rfind("AT+CLBS", 0) == 0) {
+    modemReply(1500, registered ? "\r\n+CLBS: 0,80.2707,13.0827,550\r\n\r\nOK\r\n" : "\r\n+CLBS: 1\r\n\r\nOK\r\n");
+  } else if (cmd.rfind("AT+CMGS", 0) == 0) {
+    modemInSms = true;
+    smsBody.clear();
+    modemReply(100, "\r\n> ");
+  } else {
+    modemReply(100, "\r\nOK\r\n");
+  }
+}
+
+void Device::modemWrite(uint8_t c) {
+  if (!modemPresent) return;
+
+  if (modemInSms) {
+    if (c != 26) {
+      smsBody += (char)c;
+      return;
+    }
+    // Ctrl-Z: submit the SMS
+    modemInSms = false;
+    if (inAny(gsmOutages, nowUs)) {
+      modemReply(1000, "\r\nERROR\r\n");
+    } else {
+      recordSms(true, smsBody);
+      modemReply(3000, "\r\n+CMGS: 1\r\n\r\nOK\r\n");
+    }
+    return;
+  }
+
+  if (c == '\n') {
+    if (!modemLine.empty() && modemLine.back() == '\r') modemLine.pop_back();
+    if (!modemLine.empty()) modemCommand(modemLine);
+    modemLine.clear();
+  } else {
+    modemLine += (char)c;
+  }
+}
+
+int Device::modemAvailable() {
+  if (modemRx.empty() || modemRx.front().readyUs > nowUs) return 0;
+  return (int)(modemRx.front().text.size() - modemRxPos);
+}
+
+int Device::modemRead() {
+  if (modemAvailable() == 0) return -1;
+  char c = modemRx.front().text[modemRxPos++];
+  if (modemRxPos >= modemRx.front().text.size()) {
+    modemRx.pop_front();
+    modemRxPos = 0;
+  }
+  return (uint8_t)c;
+}
+
+// -------------------------------------------------------------------------
+// NEO-6M GPS (NMEA OVER SOFTWARE SERIAL)
+// -------------------------------------------------------------------------
+int Device::gpsAvailable() {
+  if (gpsPos >= gpsSentence.size()) {
+    if (nowUs < nextGpsUs) return 0;
+    time_t t = (time_t)(EPOCH_BASE_SEC + nowUs / 1000000);
+    struct tm utc;
+    gmtime_r(&t, &utc);
+    char buf[96];
+    snprintf(buf, sizeof(buf), "$GNRMC,%02d%02d%02d.00,%c,1304.9620,N,08016.2420,E,0.12,,010126,,,A*6C\r\n",
+             utc.tm_hour, utc.tm_min, utc.tm_sec, nowUs >= gpsFixUs ? 'A' : 'V');
+    gpsSentence = buf;
+    gpsPos = 0;
+    nextGpsUs = nowUs + GPS_PERIOD_US;
+  }
+  return (int)(gpsSentence.size() - gpsPos);
+}
+
+int Device::gpsRead() {
+  if (gpsAvailable() == 0) return -1;
+  return (uint8_t)gpsSentence[gpsPos++];
+}
+
+// -------------------------------------------------------------------------
+// BATTERY (~6 %/h discharge, never charging)
+// -------------------------------------------------------------------------
+int Device::batteryLevel() const {
+  double hours = (nowUs - bootUs) / 3.6e9;
+  return std::max(0, batteryAtBoot - (int)(hours * 6.0));
+}
+
+float Device::batteryVoltage() const {
+  return 3.3f + 0.009f * batteryLevel();
+}
+
+// -------------------------------------------------------------------------
+// ALERT ACCOUNTING
+// -------------------------------------------------------------------------
+// Pairs each SMS with the oldest injected event of the same kind that has
+// already happened; an SMS with nothing to pair with is a false alarm.
+void Device::recordSms(bool viaGsm, const std::string& body) {
+  (viaGsm ? metrics->smsViaGsm : metrics->smsViaTwilio)++;
+
+  size_t at = body.find("Source: ");
+  std::string source = at == std::string::npos ? "" : body.substr(at + 8, body.find('\n', at) - at - 8);
+  bool manual = source.find("SOS") != std::string::npos;
+
+  std::deque<uint64_t>& pending = manual ? pendingSos : pendingAi;
+  if (pending.empty() || pending.front() > nowUs) {
+    metrics->falseAlarms++;
+    return;
+  }
+  double latencyMs = (nowUs - pending.front()) / 1000.0;
+  pending.pop_front();
+  if (manual) {
+    metrics->matchedSos++;
+    metrics->sosAlertMs.add(latencyMs);
+  } else {
+    metrics->matchedAi++;
+    metrics->aiAlertMs.add(latencyMs);
+  }
+}
+
+}
@@ -0,0 +1,147 @@
+#ifndef SIM_DEVICE_H
+#define SIM_DEVICE_H
+
+#include <array>
+#include <cstdint>
+#include <ctime>
+#include <deque>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+#include "esp_now.h"
+#include "Metrics.h"
+
+namespace sim {
+
+class BackendPool;
+
+// [startUs, endUs) in fleet virtual time
+struct Window {
+  uint64_t startUs;
+  uint64_t endUs;
+
+  bool contains(uint64_t t) const { return t >= startUs && t < endUs; }
+  bool overlaps(uint64_t from, uint64_t to) const { return startUs <= to && from < endUs; }
+};
+
+// Physical world of one watch: its virtual clock, the WiFi link, SIM800L
+// modem, GPS, IMU, KEY1 button, battery and the paired smart dress.
+// The HAL shims forward every hardware call to sim::current().
+//
+// Time only moves when the firmware spends it: delay() advances the clock
+// directly and every millis()/micros() read costs pollCostUs, so the
+// firmware's busy-wait loops terminate in virtual time.
+class Device {
+  public:
+    int id = 0;
+    bool verbose = false;       // echo this watch's Serial console
+    bool modemPresent = true;
+    Metrics* metrics = nullptr;
+    BackendPool* backend = nullptr;
+    // Suspends this watch's firmware until its backend request completes.
+    // Installed by the fleet scheduler; only needed when backend is set.
+    std::function<void()> park;
+
+    // --- CLOCK (fleet virtual time, us) ---
+    uint64_t bootUs = 0;
+    uint64_t nowUs = 0;
+    uint64_t pollCostUs = 500;
+
+    // --- SCENARIO (fleet virtual time) ---
+    std::vector<uint64_t> falls;
+    std::vector<uint64_t> sosPresses;
+    std::vector<Window> squeezes;
+    std::vector<Window> wifiOutages;
+    std::vector<Window> backendOutages;
+    std::vector<Window> gsmOutages;
+
+    // --- RESULTS ---
+    uint64_t maxSampleGapUs = 0;
+    // Injected events whose SMS never arrived
+    size_t undelivered() const { return pendingAi.size() + pendingSos.size(); }
+
+    void reset(int watchId, uint64_t seed, uint64_t powerOnUs);
+    // Sorts the scenario and queues the injected events that should each
+    // produce one SMS. Call once after the scenario is loaded.
+    void finalizeScript();
+
+    unsigned long millisSinceBoot() { nowUs += pollCostUs; return (unsigned long)((nowUs - bootUs) / 1000); }
+    unsigned long microsSinceBoot() { nowUs += pollCostUs; return (unsigned long)(nowUs - bootUs); }
+    void advanceMs(uint64_t ms) { nowUs += ms * 1000; }
+
+    // --- PERIPHERALS ---
+    void consoleWrite(uint8_t c);
+    int readPin(int pin) const;
+    void readAcceleration(float& x, float& y, float& z);
+    // True if the last `samples` readings this watch served are exactly
+    // the x/y/z columns of frame (stride floats per sample)
+    bool servedWindow(const float* frame, size_t samples, size_t stride) const;
+    void setEspNowCallback(esp_now_recv_cb_t cb) { espNowCb = cb; }
+
+    void wifiBegin();
+    void wifiDisconnect() { wifiAssocUs = UINT64_MAX; }
+    bool wifiConnected() const;
+    void ntpConfigure(long gmtOffsetSec);
+    bool ntpTime(struct tm* info);
+    // True exactly once, the first time it is asked after the sync landed
+    bool ntpSyncCompleted();
+
+    int httpPost(const std::string& url, bool secure, const std::string& body, uint16_t timeoutMs);
+
+    void modemWrite(uint8_t c);
+    int modemAvailable();
+    int modemRead();
+
+    int gpsAvailable();
+    int gpsRead();
+
+    int batteryLevel() const;
+    float batteryVoltage() const;
+
+  private:
+    std::mt19937_64 rng;
+    std::normal_distribution<float> noise{0.0f, 0.03f};
+
+    std::string consoleLine;
+    esp_now_recv_cb_t espNowCb = nullptr;
+    uint64_t nextDressUs = 0;
+    uint64_t lastSampleUs = 0;
+    std::deque<std::array<float, 3>> recentReads;  // newest last
+
+    uint64_t wifiAssocUs = UINT64_MAX;
+    uint64_t ntpSyncedUs = UINT64_MAX;
+    bool ntpSyncReported = false;
+    long gmtOffset = 0;
+
+    // Modem: bytes become readable once their reply is due
+    struct ModemReply { uint64_t readyUs; std::string text; };
+    std::deque<ModemReply> modemRx;
+    size_t modemRxPos = 0;
+    std::string modemLine;
+    bool modemInSms = false;
+    std::string smsBody;
+
+    std::string gpsSentence;
+    size_t gpsPos = 0;
+    uint64_t nextGpsUs = 0;
+    uint64_t gpsFixUs = 0;
+
+    int batteryAtBoot = 100;
+
+    // Injected events still waiting for their SMS, oldest first
+    std::deque<uint64_t> pendingAi;
+    std::deque<uint64_t> pendingSos;
+
+    bool inAny(const std::vector<Window>& windows, uint64_t t) const;
+    void modemCommand(const std::string& cmd);
+    void modemReply(uint64_t delayMs, const std::string& text);
+    void recordSms(bool viaGsm, const std::string& body);
+};
+
+extern Device* g_current;
+inline Device* current() { return g_current; }
+
+}
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef SOFTWARESERIAL_H
+#define SOFTWARESERIAL_H
+
+#include "Stream.h"
+
+// Bit-banged UART shim, receive-only: wired to the simulated NEO-6M GPS.
+class SoftwareSerial : public Stream {
+  public:
+    SoftwareSerial(int rxPin, int txPin) { (void)rxPin; (void)txPin; }
+
+    void begin(unsigned long baud) { (void)baud; }
+
+    using Print::write;
+    size_t write(uint8_t c) override { (void)c; return 1; }
+    int available() override;
+    int read() override;
+};
+
+#endif
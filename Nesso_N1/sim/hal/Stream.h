@@ -0,0 +1,80 @@
+#ifndef STREAM_H
+#define STREAM_H
+
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include "WString.h"
+
+// Arduino Print: formatting on top of a single write(uint8_t).
+// Sinks that discard their output (a muted console) return false from
+// enabled() so the formatting work is skipped entirely.
+class Print {
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual bool enabled() { return true; }
+
+    size_t write(const uint8_t* buf, size_t len) {
+      for (size_t i = 0; i < len; i++) write(buf[i]);
+      return len;
+    }
+
+    size_t print(const String& s) { return enabled() ? writeStr(s.c_str()) : 0; }
+    size_t print(const char* s) { return enabled() ? writeStr(s) : 0; }
+    size_t print(char c) { return enabled() ? write((uint8_t)c) : 0; }
+    size_t print(int v) { return enabled() ? writeFmt("%d", v) : 0; }
+    size_t print(unsigned int v) { return enabled() ? writeFmt("%u", v) : 0; }
+    size_t print(long v) { return enabled() ? writeFmt("%ld", v) : 0; }
+    size_t print(unsigned long v) { return enabled() ? writeFmt("%lu", v) : 0; }
+    size_t print(double v, int decimals = 2) { return enabled() ? writeFmt("%.*f", decimals, v) : 0; }
+
+    size_t println() { return enabled() ? writeStr("\r\n") : 0; }
+    template <typename T>
+    size_t println(T v) { size_t n = print(v); return n + println(); }
+
+    size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+      if (!enabled()) return 0;
+      char buf[256];
+      va_list args;
+      va_start(args, fmt);
+      vsnprintf(buf, sizeof(buf), fmt, args);
+      va_end(args);
+      return writeStr(buf);
+    }
+
+  private:
+    size_t writeStr(const char* s) {
+      if (!s) return 0;
+      return write((const uint8_t*)s, strlen(s));
+    }
+    size_t writeFmt(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+      char buf[64];
+      va_list args;
+      va_start(args, fmt);
+      vsnprintf(buf, sizeof(buf), fmt, args);
+      va_end(args);
+      return writeStr(buf);
+    }
+};
+
+// Arduino Stream: a Print that can also be read from.
+class Stream : public Print {
+  public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+
+    String readStringUntil(char terminator) {
+      String out;
+      while (available()) {
+        int c = read();
+        if (c < 0 || c == terminator) break;
+        out += (char)c;
+      }
+      return out;
+    }
+};
+
+#endif
@@ -0,0 +1,163 @@
+#include "StubBackend.h"
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cstdlib>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace sim {
+
+// Unmasked server -> client text frame
+static std::string wsText(const std::string& payload) {
+  std::string frame(1, (char)0x81);
+  if (payload.size() < 126) {
+    frame += (char)payload.size();
+  } else {
+    frame += (char)126;
+    frame += (char)((payload.size() >> 8) & 0xFF);
+    frame += (char)(payload.size() & 0xFF);
+  }
+  return frame + payload;
+}
+
+// Next client -> server frame (masked, never fragmented by DashboardSubscriber)
+static bool wsRead(int fd, std::string& rx, uint8_t& opcode, std::string& payload) {
+  for (;;) {
+    if (rx.size() >= 2) {
+      const uint8_t* p = (const uint8_t*)rx.data();
+      size_t len = p[1] & 0x7F;
+      size_t pos = 2;
+      if (len == 126 && rx.size() >= 4) {
+        len = ((size_t)p[2] << 8) | p[3];
+        pos = 4;
+      }
+      if (len < 127 && rx.size() >= pos + 4 + len) {
+        opcode = p[0] & 0x0F;
+        payload.assign(rx, pos + 4, len);
+        for (size_t i = 0; i < len; i++) payload[i] ^= p[pos + i % 4];
+        rx.erase(0, pos + 4 + len);
+        return true;
+      }
+    }
+    char buf[512];
+    ssize_t n = recv(fd, buf, sizeof(buf), 0);
+    if (n <= 0) return false;
+    rx.append(buf, (size_t)n);
+  }
+}
+
+bool StubBackend::start() {
+  listenFd = socket(AF_INET, SOCK_STREAM, 0);
+  if (listenFd < 0) return false;
+  sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addr.sin_port = 0;
+  socklen_t len = sizeof(addr);
+  if (bind(listenFd, (sockaddr*)&addr, sizeof(addr)) != 0 || listen(listenFd, 256) != 0 ||
+      getsockname(listenFd, (sockaddr*)&addr, &len) != 0) {
+    close(listenFd);
+    listenFd = -1;
+    return false;
+  }
+  port = ntohs(addr.sin_port);
+  acceptor = std::thread(&StubBackend::accept, this);
+  return true;
+}
+
+void StubBackend::stop() {
+  if (listenFd < 0) return;
+  shutdown(listenFd, SHUT_RDWR);
+  acceptor.join();
+  close(listenFd);
+  listenFd = -1;
+
+  std::unique_lock<std::mutex> lock(mu);
+  for (int fd : openFds) shutdown(fd, SHUT_RDWR);
+  allClosed.wait(lock, [this] { return openFds.empty(); });
+}
+
+void StubBackend::accept() {
+  for (;;) {
+    int fd = ::accept(listenFd, nullptr, nullptr);
+    if (fd < 0) return;
+    std::lock_guard<std::mutex> lock(mu);
+    openFds.push_back(fd);
+    std::thread(&StubBackend::serve, this, fd).detach();
+  }
+}
+
+void StubBackend::serve(int fd) {
+  std::string rx;
+  size_t headerEnd;
+  char buf[4096];
+  while ((headerEnd = rx.find("\r\n\r\n")) == std::string::npos) {
+    ssize_t n = recv(fd, buf, sizeof(buf), 0);
+    if (n <= 0) break;
+    rx.append(buf, (size_t)n);
+  }
+
+  if (headerEnd != std::string::npos) {
+    std::string head = rx.substr(0, headerEnd);
+    rx.erase(0, headerEnd + 4);
+    if (head.rfind("GET /socket.io/", 0) == 0) {
+      serveDashboard(fd, rx);
+    } else {
+      size_t cl = head.find("Content-Length:");
+      size_t length = cl == std::string::npos ? 0 : (size_t)atol(head.c_str() + cl + 15);
+      while (rx.size() < length) {
+        ssize_t n = recv(fd, buf, sizeof(buf), 0);
+        if (n <= 0) break;
+        rx.append(buf, (size_t)n);
+      }
+
+      // Express's JSON parser rejects raw control characters in strings
+      bool valid = rx.size() == length &&
+                   std::none_of(rx.begin(), rx.end(), [](char c) { return (unsigned char)c < 0x20; });
+      std::string status = valid ? "201 Created" : "400 Bad Request";
+      if (valid) broadcast(head.find("/api/telemetry") != std::string::npos ? "new-telemetry" : "new-panic-alert", rx);
+      std::string reply = "HTTP/1.1 " + status + "\r\nContent-Type: application/json\r\n"
+                          "Content-Length: 16\r\nConnection: close\r\n\r\n{\"success\":true}";
+      send(fd, reply.data(), reply.size(), MSG_NOSIGNAL);
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(mu);
+  openFds.erase(std::find(openFds.begin(), openFds.end(), fd));
+  dashboards.erase(std::remove(dashboards.begin(), dashboards.end(), fd), dashboards.end());
+  close(fd);
+  if (openFds.empty()) allClosed.notify_all();
+}
+
+// Engine.IO v4 over WebSocket: open, namespace join, one ping, then
+// broadcasts until the client goes away. Sec-WebSocket-Accept is left
+// out; DashboardSubscriber is the only client and does not check it.
+void StubBackend::serveDashboard(int fd, std::string rx) {
+  std::string upgrade = "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n\r\n" +
+                        wsText("0{\"sid\":\"stub\",\"pingInterval\":25000,\"pingTimeout\":20000}");
+  send(fd, upgrade.data(), upgrade.size(), MSG_NOSIGNAL);
+
+  uint8_t opcode;
+  std::string payload;
+  if (!wsRead(fd, rx, opcode, payload) || payload != "40") return;
+  {
+    std::lock_guard<std::mutex> lock(mu);
+    std::string joined = wsText("40{\"sid\":\"stub\"}") + wsText("2");
+    send(fd, joined.data(), joined.size(), MSG_NOSIGNAL);
+    dashboards.push_back(fd);
+  }
+
+  while (wsRead(fd, rx, opcode, payload)) {
+    if (opcode == 0x8) return;  // close
+  }
+}
+
+void StubBackend::broadcast(const std::string& event, const std::string& body) {
+  std::string frame = wsText("42[\"" + event + "\"," + body + "]");
+  std::lock_guard<std::mutex> lock(mu);
+  for (int fd : dashboards) send(fd, frame.data(), frame.size(), MSG_NOSIGNAL);
+}
+
+}
@@ -0,0 +1,45 @@
+#ifndef SIM_STUB_BACKEND_H
+#define SIM_STUB_BACKEND_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace sim {
+
+// In-process stand-in for the NestJS backend on a loopback port, so the
+// worker pool, fiber parking and dashboard subscribers run under ctest.
+// Like AppController it answers every POST with 201 and broadcasts the
+// body (new-panic-alert or new-telemetry) to every socket.io client.
+class StubBackend {
+  public:
+    ~StubBackend() { stop(); }
+
+    // Listens on 127.0.0.1 at a free port; false if it cannot
+    bool start();
+    void stop();
+
+    // "127.0.0.1:<port>" for --backend
+    std::string hostPort() const { return "127.0.0.1:" + std::to_string(port); }
+
+  private:
+    int listenFd = -1;
+    uint16_t port = 0;
+    std::thread acceptor;
+    std::mutex mu;
+    std::condition_variable allClosed;
+    std::vector<int> openFds;     // one detached thread serves each
+    std::vector<int> dashboards;  // joined socket.io clients
+
+    void accept();
+    void serve(int fd);
+    void serveDashboard(int fd, std::string rx);
+    void broadcast(const std::string& event, const std::string& body);
+};
+
+}
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef WSTRING_H
+#define WSTRING_H
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+// Host stand-in for the Arduino String class, backed by std::string.
+// Only the subset the firmware uses is implemented.
+class String {
+  public:
+    String() {}
+    String(const char* s) : str(s ? s : "") {}
+    String(const std::string& s) : str(s) {}
+    String(char c) : str(1, c) {}
+    String(int v) : str(std::to_string(v)) {}
+    String(unsigned int v) : str(std::to_string(v)) {}
+    String(long v) : str(std::to_string(v)) {}
+    String(unsigned long v) : str(std::to_string(v)) {}
+    String(float v, unsigned int decimals = 2) : String((double)v, decimals) {}
+    String(double v, unsigned int decimals = 2) {
+      char buf[48];
+      snprintf(buf, sizeof(buf), "%.*f", (int)decimals, v);
+      str = buf;
+    }
+
+    const char* c_str() const { return str.c_str(); }
+    const std::string& std() const { return str; }
+    unsigned int length() const { return (unsigned int)str.size(); }
+
+    int indexOf(char c, unsigned int from = 0) const {
+      size_t pos = str.find(c, from);
+      return pos == std::string::npos ? -1 : (int)pos;
+    }
+    int indexOf(const String& s, unsigned int from = 0) const {
+      size_t pos = str.find(s.str, from);
+      return pos == std::string::npos ? -1 : (int)pos;
+    }
+
+    // Same clamping/swapping rules as the Arduino core
+    String substring(unsigned int from) const { return substring(from, length()); }
+    String substring(unsigned int from, unsigned int to) const {
+      if (from > to) { unsigned int t = from; from = to; to = t; }
+      if (from >= length()) return String();
+      if (to > length()) to = length();
+      return String(str.substr(from, to - from));
+    }
+
+    bool startsWith(const String& prefix) const { return str.compare(0, prefix.str.size(), prefix.str) == 0; }
+    long toInt() const { return atol(str.c_str()); }
+
+    // Strips leading/trailing whitespace and control characters (isspace)
+    void trim() {
+      size_t first = str.find_first_not_of(" \t\r\n\v\f");
+      if (first == std::string::npos) { str.clear(); return; }
+      str = str.substr(first, str.find_last_not_of(" \t\r\n\v\f") - first + 1);
+    }
+
+    String& operator+=(const String& rhs) { str += rhs.str; return *this; }
+    String& operator+=(const char* rhs) { if (rhs) str += rhs; return *this; }
+    String& operator+=(char c) { str += c; return *this; }
+
+    char operator[](unsigned int i) const { return i < str.size() ? str[i] : 0; }
+
+    friend String operator+(const String& a, const String& b) { return String(a.str + b.str); }
+    friend bool operator==(const String& a, const String& b) { return a.str == b.str; }
+    friend bool operator!=(const String& a, const String& b) { return a.str != b.str; }
+
+  private:
+    std::string str;
+};
+
+#endif
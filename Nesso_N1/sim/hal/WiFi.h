@@ -0,0 +1,36 @@
+#ifndef WIFI_H
+#define WIFI_H
+
+#include <Arduino.h>
+
+typedef enum {
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_CONNECTION_LOST = 5,
+  WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 } wifi_mode_t;
+
+// Station interface of the current watch. Association takes a few virtual
+// seconds and drops for good during scripted WiFi outages, so the firmware
+// has to call begin() again to recover, as on the device.
+class WiFiClass {
+  public:
+    bool mode(wifi_mode_t m) { (void)m; return true; }
+    wl_status_t begin(const char* ssid, const char* passphrase);
+    wl_status_t status();
+    bool disconnect(bool wifiOff = false);
+};
+
+extern WiFiClass WiFi;
+
+class WiFiClient {
+  public:
+    virtual ~WiFiClient() {}
+    virtual bool isSecure() const { return false; }
+};
+
+#endif
@@ -0,0 +1,11 @@
+#ifndef BASE64_H
+#define BASE64_H
+
+#include "WString.h"
+
+class base64 {
+  public:
+    static String encode(const String& text);
+};
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef ESP_NOW_H
+#define ESP_NOW_H
+
+#include <cstdint>
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+
+typedef struct esp_now_recv_info {
+  uint8_t* src_addr;
+  uint8_t* des_addr;
+  void* rx_ctrl;
+} esp_now_recv_info_t;
+
+typedef void (*esp_now_recv_cb_t)(const esp_now_recv_info_t* info, const uint8_t* data, int len);
+
+// Packets come from the simulated smart dress paired with each watch
+esp_err_t esp_now_init();
+esp_err_t esp_now_register_recv_cb(esp_now_recv_cb_t cb);
+
+#endif
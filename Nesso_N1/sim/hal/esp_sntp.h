@@ -0,0 +1,15 @@
+#ifndef ESP_SNTP_H
+#define ESP_SNTP_H
+
+// Host stand-in for the ESP-IDF SNTP status API (lwIP SNTP behind
+// configTime()). Only the sync status query is implemented.
+typedef enum {
+  SNTP_SYNC_STATUS_RESET,
+  SNTP_SYNC_STATUS_COMPLETED,
+  SNTP_SYNC_STATUS_IN_PROGRESS,
+} sntp_sync_status_t;
+
+// COMPLETED once after the first sync, then RESET again, like ESP-IDF
+sntp_sync_status_t sntp_get_sync_status(void);
+
+#endif
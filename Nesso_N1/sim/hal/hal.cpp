@@ -0,0 +1,181 @@
+// Host implementations of the Arduino / ESP32 / Nesso N1 APIs the watch
+// firmware uses. Each call is forwarded to sim::current(), the watch the
+// fleet scheduler is stepping right now.
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <HTTPClient.h>
+#include <SoftwareSerial.h>
+#include <base64.h>
+#include <esp_now.h>
+#include <esp_sntp.h>
+#include <Arduino_Nesso_N1.h>
+#include <Arduino_BMI270_BMM150.h>
+#include <DNN_1_Dataset_inferencing.h>
+#include <cmath>
+#include <vector>
+#include "SimDevice.h"
+
+using sim::current;
+
+HardwareSerial Serial(0);
+WiFiClass WiFi;
+BoschSensorClass IMU;
+EspClass ESP;
+
+// --- TIME ---
+unsigned long millis() { return current()->millisSinceBoot(); }
+unsigned long micros() { return current()->microsSinceBoot(); }
+void delay(unsigned long ms) { current()->advanceMs(ms); }
+
+// --- GPIO ---
+void pinMode(int pin, int mode) { (void)pin; (void)mode; }
+void digitalWrite(int pin, int value) { (void)pin; (void)value; }
+int digitalRead(int pin) { return current()->readPin(pin); }
+
+// --- SNTP ---
+void configTime(long gmtOffset_sec, int daylightOffset_sec, const char* server1,
+                const char* server2, const char* server3) {
+  (void)daylightOffset_sec; (void)server1; (void)server2; (void)server3;
+  current()->ntpConfigure(gmtOffset_sec);
+}
+
+// Same loop as the esp32-hal-time helper: even with ms == 0 a miss costs
+// one delay(10) before it gives up
+bool getLocalTime(struct tm* info, uint32_t ms) {
+  unsigned long start = millis();
+  while (millis() - start <= ms) {
+    if (current()->ntpTime(info)) return true;
+    delay(10);
+  }
+  return false;
+}
+
+sntp_sync_status_t sntp_get_sync_status(void) {
+  return current()->ntpSyncCompleted() ? SNTP_SYNC_STATUS_COMPLETED : SNTP_SYNC_STATUS_RESET;
+}
+
+// --- UARTS ---
+size_t HardwareSerial::write(uint8_t c) {
+  if (port == 0) current()->consoleWrite(c);
+  else current()->modemWrite(c);
+  return 1;
+}
+
+bool HardwareSerial::enabled() {
+  return port != 0 || current()->verbose;
+}
+
+int HardwareSerial::available() {
+  return port == 0 ? 0 : current()->modemAvailable();
+}
+
+int HardwareSerial::read() {
+  return port == 0 ? -1 : current()->modemRead();
+}
+
+int SoftwareSerial::available() { return current()->gpsAvailable(); }
+int SoftwareSerial::read() { return current()->gpsRead(); }
+
+// --- WIFI / HTTP ---
+wl_status_t WiFiClass::begin(const char* ssid, const char* passphrase) {
+  (void)ssid; (void)passphrase;
+  current()->wifiBegin();
+  return WL_DISCONNECTED;
+}
+
+wl_status_t WiFiClass::status() {
+  return current()->wifiConnected() ? WL_CONNECTED : WL_DISCONNECTED;
+}
+
+bool WiFiClass::disconnect(bool wifiOff) {
+  (void)wifiOff;
+  current()->wifiDisconnect();
+  return true;
+}
+
+int HTTPClient::POST(const String& payload) {
+  return current()->httpPost(requestUrl.std(), secure, payload.std(), timeoutMs);
+}
+
+String base64::encode(const String& text) {
+  static const char table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  const std::string& in = text.std();
+  std::string out;
+  for (size_t i = 0; i < in.size(); i += 3) {
+    uint32_t n = (uint8_t)in[i] << 16;
+    if (i + 1 < in.size()) n |= (uint8_t)in[i + 1] << 8;
+    if (i + 2 < in.size()) n |= (uint8_t)in[i + 2];
+    out += table[(n >> 18) & 63];
+    out += table[(n >> 12) & 63];
+    out += i + 1 < in.size() ? table[(n >> 6) & 63] : '=';
+    out += i + 2 < in.size() ? table[n & 63] : '=';
+  }
+  return String(out);
+}
+
+// --- ESP-NOW ---
+esp_err_t esp_now_init() { return ESP_OK; }
+
+esp_err_t esp_now_register_recv_cb(esp_now_recv_cb_t cb) {
+  current()->setEspNowCallback(cb);
+  return ESP_OK;
+}
+
+// --- BOARD ---
+int NessoBattery::getChargeLevel() { return current()->batteryLevel(); }
+float NessoBattery::getVoltage() { return current()->batteryVoltage(); }
+
+int BoschSensorClass::readAcceleration(float& x, float& y, float& z) {
+  current()->readAcceleration(x, y, z);
+  return 1;
+}
+
+// --- CLASSIFIER STAND-IN ---
+static const float IMPACT_G = 2.5f;
+static const float HORIZONTAL_G = 0.7f;
+static const float SQUEEZE_PRESSURE = 2500.0f;
+static const int DSP_MS = 3;
+static const int NN_MS = 9;
+
+EI_IMPULSE_ERROR run_classifier(signal_t* signal, ei_impulse_result_t* result, bool debug) {
+  (void)debug;
+  if (signal->total_length != EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE) return EI_IMPULSE_ERROR_SHAPES_DONT_MATCH;
+
+  std::vector<float> frame(signal->total_length);
+  signal->get_data(0, frame.size(), frame.data());
+
+  const size_t samples = EI_CLASSIFIER_RAW_SAMPLE_COUNT;
+  // A leak of firmware state between watches shows up here first
+  if (!current()->servedWindow(frame.data(), samples, EI_CLASSIFIER_RAW_SAMPLES_PER_FRAME)) {
+    current()->metrics->foreignWindows++;
+  }
+  size_t peakIdx = 0;
+  float peakG = 0.0f;
+  float pressureSum = 0.0f;
+  for (size_t i = 0; i < samples; i++) {
+    const float* s = &frame[i * EI_CLASSIFIER_RAW_SAMPLES_PER_FRAME];
+    float mag = sqrtf(s[0] * s[0] + s[1] * s[1] + s[2] * s[2]);
+    if (mag > peakG) { peakG = mag; peakIdx = i; }
+    pressureSum += s[3];
+  }
+
+  // Posture after the impact: lying down puts gravity on the x axis
+  float tailX = 0.0f;
+  size_t tailCount = 0;
+  for (size_t i = peakIdx + 5; i < samples; i++) {
+    tailX += fabsf(frame[i * EI_CLASSIFIER_RAW_SAMPLES_PER_FRAME]);
+    tailCount++;
+  }
+  bool horizontal = tailCount < 10 || tailX / tailCount > HORIZONTAL_G;
+  bool fall = peakG > IMPACT_G && horizontal;
+  bool squeeze = pressureSum / samples > SQUEEZE_PRESSURE;
+
+  float panic = (fall || squeeze) ? 0.95f : 0.02f;
+  result->classification[0] = {"normal", 1.0f - panic};
+  result->classification[1] = {"panic", panic};
+  result->timing.dsp = DSP_MS;
+  result->timing.classification = NN_MS;
+  current()->advanceMs(DSP_MS + NN_MS);
+  return EI_IMPULSE_OK;
+}